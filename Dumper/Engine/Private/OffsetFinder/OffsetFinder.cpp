@@ -13,35 +13,42 @@ int32_t OffsetFinder::FindUObjectFlagsOffset()
 	/* We're looking for a commonly occuring flag and this number basically defines the minimum number that counts ad "commonly occuring". */
 	constexpr auto MinNumFlagValuesRequiredAtOffset = 0xA0;
 
-	for (int i = 0; i < 0x20; i++)
+	/* Number of objects whose flag-candidates are tried, and number of objects checked for how common a candidate is. */
+	constexpr auto NumObjectsToTakeCandidatesFrom = 0x20;
+	constexpr auto NumObjectsToCountFlagsIn = 0x100;
+
+	/* The bytes of all objects are gathered once, every candidate offset is a column of the match-matrix. */
+	OffsetSolver<int32, 4> Solver(0x0, 0x40);
+
+	int Counter = 0;
+	for (UEObject Obj : ObjectArray())
 	{
-		int Offset = 0x0;
-		while (Offset != OffsetNotFound)
-		{
-			// Look for 0x43 in this object, as it is a really common value for UObject::Flags
-			Offset = FindOffset(std::vector{ std::pair{ ObjectArray::GetByIndex(i).GetAddress(), EnumFlagValueToSearch } }, Offset, 0x40);
+		// Only check the (possible) flags of the first 0x100 objects
+		if (Counter++ == NumObjectsToCountFlagsIn)
+			break;
 
-			if (Offset == OffsetNotFound)
-				break; // Early exit
+		if (!Obj)
+			continue;
 
-			/* We're looking for a common flag. To check if the flag  is common we're checking the first 0x100 objects to see how often the flag occures at this offset. */
-			int32 NumObjectsWithFlagAtOffset = 0x0;
+		Solver.AddSample(Obj.GetAddress(), EnumFlagValueToSearch);
+	}
 
-			int Counter = 0;
-			for (UEObject Obj : ObjectArray())
-			{
-				// Only check the (possible) flags of the first 0x100 objects
-				if (Counter++ == 0x100)
-					break;
+	const std::vector<uint8_t> Matches = Solver.GetMatchMatrix();
+	const std::vector<int32_t> NumObjectsWithFlagAtColumn = Solver.GetColumnMatchCounts(Matches);
 
-				const int32 TypedValueAtOffset = *reinterpret_cast<int32*>(reinterpret_cast<uintptr_t>(Obj.GetAddress()) + Offset);
+	const int32_t NumColumns = Solver.GetNumColumns();
+	const int32_t NumCandidateObjects = Solver.GetNumSamples() < NumObjectsToTakeCandidatesFrom ? Solver.GetNumSamples() : NumObjectsToTakeCandidatesFrom;
 
-				if (TypedValueAtOffset == EnumFlagValueToSearch)
-					NumObjectsWithFlagAtOffset++;
-			}
+	for (int i = 0; i < NumCandidateObjects; i++)
+	{
+		// Look for 0x43 in this object, as it is a really common value for UObject::Flags
+		const uint8_t* ObjectMatches = Matches.data() + (i * NumColumns);
 
-			if (NumObjectsWithFlagAtOffset > MinNumFlagValuesRequiredAtOffset)
-				return Offset;
+		for (int32_t Column = 0; Column < NumColumns; Column++)
+		{
+			/* We're looking for a common flag, it needs to occur at this offset in enough of the first 0x100 objects. */
+			if (ObjectMatches[Column] && NumObjectsWithFlagAtColumn[Column] > MinNumFlagValuesRequiredAtOffset)
+				return Solver.ColumnToOffset(Column);
 		}
 	}
 
@@ -1,6 +1,9 @@
 #include <format>
+#include <chrono>
 
 #include "Utils.h"
+#include "TaskGraph.h"
+#include "Profiler/Profiler.h"
 
 #include "OffsetFinder/Offsets.h"
 #include "OffsetFinder/OffsetFinder.h"
@@ -44,9 +47,8 @@ void Off::InSDK::ProcessEvent::InitPE_Windows()
 
 	if (!FuncPtr)
 	{
-		const void* StringRefAddr = Platform::FindByStringInAllSections(L"Accessed None", 0x0, 0x0, Settings::General::bSearchOnlyExecutableSectionsForStrings);
-		/* ProcessEvent is sometimes located right after a func with the string L"Accessed None. Might as well check for it, because else we're going to crash anyways. */
-		const void* PossiblePEAddr = reinterpret_cast<void*>(Architecture_x86_64::FindNextFunctionStart(StringRefAddr));
+		/* Might as well check for it, because else we're going to crash anyways. */
+		const void* PossiblePEAddr = FindPECandidateByString_Windows();
 
 		auto IsSameAddr = [PossiblePEAddr](const uint8_t* FuncAddress, [[maybe_unused]] int32_t Index) -> bool
 		{
@@ -73,6 +75,20 @@ void Off::InSDK::ProcessEvent::InitPE_Windows()
 #endif // PLATFORM_WINDOWS
 }
 
+const void* Off::InSDK::ProcessEvent::FindPECandidateByString_Windows()
+{
+#ifdef PLATFORM_WINDOWS
+
+	const void* StringRefAddr = Platform::FindByStringInAllSections(L"Accessed None", 0x0, 0x0, Settings::General::bSearchOnlyExecutableSectionsForStrings);
+
+	/* ProcessEvent is sometimes located right after a func with the string L"Accessed None. */
+	return reinterpret_cast<void*>(Architecture_x86_64::FindNextFunctionStart(StringRefAddr));
+
+#endif // PLATFORM_WINDOWS
+
+	return nullptr;
+}
+
 void Off::InSDK::ProcessEvent::InitPE(const int32 Index, const char* const ModuleName)
 {
 	Off::InSDK::ProcessEvent::PEIndex = Index;
@@ -261,69 +277,143 @@ void Off::Init()
 		}
 	};
 
-	Off::UObject::Flags = OffsetFinder::FindUObjectFlagsOffset();
-	OverwriteIfInvalidOffset(Off::UObject::Flags, sizeof(void*)); // Default to right after VTable
-	std::cerr << std::format("Off::UObject::Flags: 0x{:X}\n", Off::UObject::Flags);
+	/*
+	* Every task finds the offsets it is named after and is the only one writing them. A task depends on all tasks whose offsets (or Settings::Internal
+	* flags) it reads, either directly or through the engine-wrappers (eg. FindStructFast reads UClass::CastFlags, FindMember reads the Children/Next and
+	* FField offsets). The graph only starts a task once its dependencies have finished, so every offset is published before anything reads it.
+	*
+	* UObject::Flags -> Index -> Class -> Outer -> Name -> FName settings -+-> UClass::CastFlags -> UStruct::Children -> UField::Next, FField offsets -> Property offsets
+	*                                                                      +-> UStruct::SuperStruct, Size, MinAlignment
+	*/
+	TaskGraph InitGraph;
+
+	const auto UObjectFlags = InitGraph.AddTask("Off::UObject::Flags", [&]()
+	{
+		int32 Flags = OffsetFinder::FindUObjectFlagsOffset();
+		OverwriteIfInvalidOffset(Flags, sizeof(void*)); // Default to right after VTable
 
-	Off::UObject::Index = OffsetFinder::FindUObjectIndexOffset();
-	OverwriteIfInvalidOffset(Off::UObject::Index, (Off::UObject::Flags + sizeof(int32))); // Default to right after Flags
-	std::cerr << std::format("Off::UObject::Index: 0x{:X}\n", Off::UObject::Index);
+		Off::UObject::Flags = Flags;
+		std::cerr << std::format("Off::UObject::Flags: 0x{:X}\n", Off::UObject::Flags);
+	});
 
-	Off::UObject::Class = OffsetFinder::FindUObjectClassOffset();
-	OverwriteIfInvalidOffset(Off::UObject::Class, (Off::UObject::Index + sizeof(int32))); // Default to right after Index
-	std::cerr << std::format("Off::UObject::Class: 0x{:X}\n", Off::UObject::Class);
+	const auto UObjectIndex = InitGraph.AddTask("Off::UObject::Index", [&]()
+	{
+		int32 Index = OffsetFinder::FindUObjectIndexOffset();
+		OverwriteIfInvalidOffset(Index, (Off::UObject::Flags + sizeof(int32))); // Default to right after Flags
 
-	Off::UObject::Outer = OffsetFinder::FindUObjectOuterOffset();
-	std::cerr << std::format("Off::UObject::Outer: 0x{:X}\n", Off::UObject::Outer);
+		Off::UObject::Index = Index;
+		std::cerr << std::format("Off::UObject::Index: 0x{:X}\n", Off::UObject::Index);
+	}, { UObjectFlags });
 
-	Off::UObject::Name = OffsetFinder::FindUObjectNameOffset();
-	OverwriteIfInvalidOffset(Off::UObject::Name, (Off::UObject::Class + sizeof(void*))); // Default to right after Class
-	std::cerr << std::format("Off::UObject::Name: 0x{:X}\n\n", Off::UObject::Name);
+	const auto UObjectClass = InitGraph.AddTask("Off::UObject::Class", [&]()
+	{
+		int32 Class = OffsetFinder::FindUObjectClassOffset();
+		OverwriteIfInvalidOffset(Class, (Off::UObject::Index + sizeof(int32))); // Default to right after Index
 
-	OverwriteIfInvalidOffset(Off::UObject::Outer, (Off::UObject::Name + sizeof(int32) + sizeof(int32)));  // Default to right after Name
+		Off::UObject::Class = Class;
+		std::cerr << std::format("Off::UObject::Class: 0x{:X}\n", Off::UObject::Class);
+	}, { UObjectIndex });
 
-	OffsetFinder::InitFNameSettings();
+	const auto UObjectOuter = InitGraph.AddTask("Off::UObject::Outer", [&]()
+	{
+		Off::UObject::Outer = OffsetFinder::FindUObjectOuterOffset();
+		std::cerr << std::format("Off::UObject::Outer: 0x{:X}\n", Off::UObject::Outer);
+	}, { UObjectClass });
 
-	::NameArray::PostInit();
+	const auto UObjectName = InitGraph.AddTask("Off::UObject::Name", [&]()
+	{
+		int32 Name = OffsetFinder::FindUObjectNameOffset();
+		OverwriteIfInvalidOffset(Name, (Off::UObject::Class + sizeof(void*))); // Default to right after Class
 
-	// Castflags needs to stay here since the FindChildOffset() uses CastFlags
-	Off::UClass::CastFlags = OffsetFinder::FindCastFlagsOffset();
-	std::cerr << std::format("Off::UClass::CastFlags: 0x{:X}\n", Off::UClass::CastFlags);
+		Off::UObject::Name = Name;
+		std::cerr << std::format("Off::UObject::Name: 0x{:X}\n\n", Off::UObject::Name);
 
-	Off::UStruct::Children = OffsetFinder::FindChildOffset();
-	std::cerr << std::format("Off::UStruct::Children: 0x{:X}\n", Off::UStruct::Children);
+		OverwriteIfInvalidOffset(Off::UObject::Outer, (Off::UObject::Name + sizeof(int32) + sizeof(int32)));  // Default to right after Name
+	}, { UObjectOuter });
 
-	Off::UField::Next = OffsetFinder::FindUFieldNextOffset();
-	std::cerr << std::format("Off::UField::Next: 0x{:X}\n", Off::UField::Next);
+	const auto FNameSettings = InitGraph.AddTask("OffsetFinder::InitFNameSettings", [&]()
+	{
+		OffsetFinder::InitFNameSettings();
 
-	Off::UStruct::SuperStruct = OffsetFinder::FindSuperOffset();
-	std::cerr << std::format("Off::UStruct::SuperStruct: 0x{:X}\n", Off::UStruct::SuperStruct);
+		::NameArray::PostInit();
+	}, { UObjectName });
 
-	Off::UStruct::Size = OffsetFinder::FindStructSizeOffset();
-	std::cerr << std::format("Off::UStruct::Size: 0x{:X}\n", Off::UStruct::Size);
+	// Castflags needs to stay here since the FindChildOffset() uses CastFlags
+	const auto UClassCastFlags = InitGraph.AddTask("Off::UClass::CastFlags", [&]()
+	{
+		Off::UClass::CastFlags = OffsetFinder::FindCastFlagsOffset();
+		std::cerr << std::format("Off::UClass::CastFlags: 0x{:X}\n", Off::UClass::CastFlags);
+	}, { FNameSettings });
 
-	Off::UStruct::MinAlignment = OffsetFinder::FindMinAlignmentOffset();
-	std::cerr << std::format("Off::UStruct::MinAlignment: 0x{:X}\n", Off::UStruct::MinAlignment);
+	// Castflags become available for use
 
-	Off::UClass::CastFlags = OffsetFinder::FindCastFlagsOffset();
-	std::cerr << std::format("Off::UClass::CastFlags: 0x{:X}\n", Off::UClass::CastFlags);
+	// Sets Settings::Internal::bUseFProperty, every task reading that flag depends on this one
+	const auto UStructChildren = InitGraph.AddTask("Off::UStruct::Children", [&]()
+	{
+		Off::UStruct::Children = OffsetFinder::FindChildOffset();
+		std::cerr << std::format("Off::UStruct::Children: 0x{:X}\n", Off::UStruct::Children);
+	}, { UClassCastFlags });
 
-	// Castflags become available for use
+	const auto UFieldNext = InitGraph.AddTask("Off::UField::Next", [&]()
+	{
+		Off::UField::Next = OffsetFinder::FindUFieldNextOffset();
+		std::cerr << std::format("Off::UField::Next: 0x{:X}\n", Off::UField::Next);
+	}, { UStructChildren });
+
+	const auto UStructSuperStruct = InitGraph.AddTask("Off::UStruct::SuperStruct", [&]()
+	{
+		Off::UStruct::SuperStruct = OffsetFinder::FindSuperOffset();
+		std::cerr << std::format("Off::UStruct::SuperStruct: 0x{:X}\n", Off::UStruct::SuperStruct);
+	}, { FNameSettings });
+
+	const auto UStructSize = InitGraph.AddTask("Off::UStruct::Size", [&]()
+	{
+		Off::UStruct::Size = OffsetFinder::FindStructSizeOffset();
+		std::cerr << std::format("Off::UStruct::Size: 0x{:X}\n", Off::UStruct::Size);
+	}, { FNameSettings });
+
+	InitGraph.AddTask("Off::UStruct::MinAlignment", [&]()
+	{
+		Off::UStruct::MinAlignment = OffsetFinder::FindMinAlignmentOffset();
+		std::cerr << std::format("Off::UStruct::MinAlignment: 0x{:X}\n", Off::UStruct::MinAlignment);
+	}, { FNameSettings });
 
-	if (Settings::Internal::bUseFProperty)
+	/* The FField tasks don't do anything if the game doesn't use the FProperty system, which is only known once UStruct::Children was found. */
+	const auto UStructChildProperties = InitGraph.AddTask("Off::UStruct::ChildProperties", [&]()
 	{
+		if (!Settings::Internal::bUseFProperty)
+			return;
+
 		std::cerr << std::format("\nGame uses FProperty system\n\n");
 
 		Off::UStruct::ChildProperties = OffsetFinder::FindChildPropertiesOffset();
 		std::cerr << std::format("Off::UStruct::ChildProperties: 0x{:X}\n", Off::UStruct::ChildProperties);
 
 		OffsetFinder::FixupHardcodedOffsets(); // must be called after FindChildPropertiesOffset 
+	}, { UStructChildren });
+
+	const auto FFieldNext = InitGraph.AddTask("Off::FField::Next", [&]()
+	{
+		if (!Settings::Internal::bUseFProperty)
+			return;
 
 		Off::FField::Next = OffsetFinder::FindFFieldNextOffset();
 		std::cerr << std::format("Off::FField::Next: 0x{:X}\n", Off::FField::Next);
+	}, { UStructChildProperties });
+
+	const auto FFieldClass = InitGraph.AddTask("Off::FField::Class", [&]()
+	{
+		if (!Settings::Internal::bUseFProperty)
+			return;
 
 		Off::FField::Class = OffsetFinder::FindFFieldClassOffset();
 		std::cerr << std::format("Off::FField::Class: 0x{:X}\n", Off::FField::Class);
+	}, { UStructChildProperties });
+
+	const auto FFieldName = InitGraph.AddTask("Off::FField::Name", [&]()
+	{
+		if (!Settings::Internal::bUseFProperty)
+			return;
 
 		// Comment out this line if you're crashing here and see if the NewFindFFieldNameOffset might work!
 		Off::FField::Name = OffsetFinder::FindFFieldNameOffset();
@@ -340,96 +430,195 @@ void Off::Init()
 		*/
 		Off::FField::Flags = Off::FField::Name + Off::InSDK::Name::FNameSize;
 		std::cerr << std::format("Off::FField::Flags: 0x{:X}\n", Off::FField::Flags);
+	}, { FFieldNext, FFieldClass });
+
+	InitGraph.AddTask("Off::FField::EditorOnlyMetadata", [&]()
+	{
+		if (!Settings::Internal::bUseFProperty)
+			return;
 
 		Off::FField::EditorOnlyMetadata = OffsetFinder::FindFFieldEditorOnlyMetaDataOffset();
 		if (Off::FField::EditorOnlyMetadata != OffsetFinder::OffsetNotFound)
 			std::cerr << std::format("Off::FField::EditorOnlyMetadata: 0x{:X}\n", Off::FField::EditorOnlyMetadata);
+	}, { FFieldName });
+
+	const auto FFieldClassCastFlags = InitGraph.AddTask("Off::FFieldClass::CastFlags", [&]()
+	{
+		if (!Settings::Internal::bUseFProperty)
+			return;
 
 		Off::FFieldClass::CastFlags = OffsetFinder::FindFieldClassCastFlagsOffset();
 		std::cerr << std::format("Off::FFieldClass::CastFlags: 0x{:X}\n\n", Off::FFieldClass::CastFlags);
-	}
+	}, { FFieldClass });
 
-	Off::UStruct::StructBaseChain = OffsetFinder::FindStructBaseChainOffset();
-	if (Off::UStruct::StructBaseChain != OffsetFinder::OffsetNotFound)
-		std::cerr << std::format("Off::UStruct::StructBaseChain: 0x{:X}\n", Off::UStruct::StructBaseChain);
+	InitGraph.AddTask("Off::UStruct::StructBaseChain", [&]()
+	{
+		Off::UStruct::StructBaseChain = OffsetFinder::FindStructBaseChainOffset();
+		if (Off::UStruct::StructBaseChain != OffsetFinder::OffsetNotFound)
+			std::cerr << std::format("Off::UStruct::StructBaseChain: 0x{:X}\n", Off::UStruct::StructBaseChain);
+	}, { UStructSuperStruct, UStructSize, UStructChildProperties });
 
-	Off::UClass::ClassDefaultObject = OffsetFinder::FindDefaultObjectOffset();
-	std::cerr << std::format("Off::UClass::ClassDefaultObject: 0x{:X}\n", Off::UClass::ClassDefaultObject);
+	const auto UClassClassDefaultObject = InitGraph.AddTask("Off::UClass::ClassDefaultObject", [&]()
+	{
+		Off::UClass::ClassDefaultObject = OffsetFinder::FindDefaultObjectOffset();
+		std::cerr << std::format("Off::UClass::ClassDefaultObject: 0x{:X}\n", Off::UClass::ClassDefaultObject);
+	}, { UClassCastFlags });
+
+	InitGraph.AddTask("Off::UClass::ImplementedInterfaces", [&]()
+	{
+		Off::UClass::ImplementedInterfaces = OffsetFinder::FindImplementedInterfacesOffset();
+		std::cerr << std::format("Off::UClass::ImplementedInterfaces: 0x{:X}\n", Off::UClass::ImplementedInterfaces);
+	}, { UClassClassDefaultObject });
 
-	Off::UClass::ImplementedInterfaces = OffsetFinder::FindImplementedInterfacesOffset();
-	std::cerr << std::format("Off::UClass::ImplementedInterfaces: 0x{:X}\n", Off::UClass::ImplementedInterfaces);
+	InitGraph.AddTask("Off::UEnum::Names", [&]()
+	{
+		Off::UEnum::Names = OffsetFinder::FindEnumNamesOffset();
+		std::cerr << std::format("Off::UEnum::Names: 0x{:X}\n\n", Off::UEnum::Names);
+	}, { UClassCastFlags });
 
-	Off::UEnum::Names = OffsetFinder::FindEnumNamesOffset();
-	std::cerr << std::format("Off::UEnum::Names: 0x{:X}\n", Off::UEnum::Names) << std::endl;
+	InitGraph.AddTask("Off::UFunction::FunctionFlags", [&]()
+	{
+		Off::UFunction::FunctionFlags = OffsetFinder::FindFunctionFlagsOffset();
+		std::cerr << std::format("Off::UFunction::FunctionFlags: 0x{:X}\n", Off::UFunction::FunctionFlags);
+	}, { UClassCastFlags });
 
-	Off::UFunction::FunctionFlags = OffsetFinder::FindFunctionFlagsOffset();
-	std::cerr << std::format("Off::UFunction::FunctionFlags: 0x{:X}\n", Off::UFunction::FunctionFlags);
+	InitGraph.AddTask("Off::UFunction::ExecFunction", [&]()
+	{
+		Off::UFunction::ExecFunction = OffsetFinder::FindFunctionNativeFuncOffset();
+		std::cerr << std::format("Off::UFunction::ExecFunction: 0x{:X}\n\n", Off::UFunction::ExecFunction);
+	}, { UClassCastFlags });
 
-	Off::UFunction::ExecFunction = OffsetFinder::FindFunctionNativeFuncOffset();
-	std::cerr << std::format("Off::UFunction::ExecFunction: 0x{:X}\n", Off::UFunction::ExecFunction) << std::endl;
+	/* UEStruct::FindMember walks UField::Next, and FField::Next/Name/Class and FFieldClass::CastFlags on games using FProperty */
+	const auto PropertyElementSize = InitGraph.AddTask("Off::Property::ElementSize", [&]()
+	{
+		Off::Property::ElementSize = OffsetFinder::FindElementSizeOffset();
+		std::cerr << std::format("Off::Property::ElementSize: 0x{:X}\n", Off::Property::ElementSize);
+	}, { UFieldNext, FFieldName, FFieldClassCastFlags });
 
-	Off::Property::ElementSize = OffsetFinder::FindElementSizeOffset();
-	std::cerr << std::format("Off::Property::ElementSize: 0x{:X}\n", Off::Property::ElementSize);
+	InitGraph.AddTask("Off::Property::ArrayDim", [&]()
+	{
+		Off::Property::ArrayDim = OffsetFinder::FindArrayDimOffset();
+		std::cerr << std::format("Off::Property::ArrayDim: 0x{:X}\n", Off::Property::ArrayDim);
+	}, { PropertyElementSize });
 
-	Off::Property::ArrayDim = OffsetFinder::FindArrayDimOffset();
-	std::cerr << std::format("Off::Property::ArrayDim: 0x{:X}\n", Off::Property::ArrayDim);
+	const auto PropertyOffsetInternal = InitGraph.AddTask("Off::Property::Offset_Internal", [&]()
+	{
+		Off::Property::Offset_Internal = OffsetFinder::FindOffsetInternalOffset();
+		std::cerr << std::format("Off::Property::Offset_Internal: 0x{:X}\n", Off::Property::Offset_Internal);
+	}, { UFieldNext, FFieldName, FFieldClassCastFlags });
 
-	Off::Property::Offset_Internal = OffsetFinder::FindOffsetInternalOffset();
-	std::cerr << std::format("Off::Property::Offset_Internal: 0x{:X}\n", Off::Property::Offset_Internal);
+	InitGraph.AddTask("Off::Property::PropertyFlags", [&]()
+	{
+		Off::Property::PropertyFlags = OffsetFinder::FindPropertyFlagsOffset();
+		std::cerr << std::format("Off::Property::PropertyFlags: 0x{:X}\n", Off::Property::PropertyFlags);
+	}, { UFieldNext, FFieldName, FFieldClassCastFlags });
 
-	Off::Property::PropertyFlags = OffsetFinder::FindPropertyFlagsOffset();
-	std::cerr << std::format("Off::Property::PropertyFlags: 0x{:X}\n", Off::Property::PropertyFlags);
+	const auto BoolPropertyBase = InitGraph.AddTask("Off::BoolProperty::Base", [&]()
+	{
+		Off::BoolProperty::Base = OffsetFinder::FindBoolPropertyBaseOffset();
+		std::cerr << std::format("UBoolProperty::Base: 0x{:X}\n\n", Off::BoolProperty::Base);
+	}, { PropertyOffsetInternal });
 
-	Off::BoolProperty::Base = OffsetFinder::FindBoolPropertyBaseOffset();
-	std::cerr << std::format("UBoolProperty::Base: 0x{:X}\n", Off::BoolProperty::Base) << std::endl;
+	const auto EnumPropertyBase = InitGraph.AddTask("Off::EnumProperty::Base", [&]()
+	{
+		Off::EnumProperty::Base = OffsetFinder::FindEnumPropertyBaseOffset();
+		std::cerr << std::format("Off::EnumProperty::Base: 0x{:X}\n\n", Off::EnumProperty::Base);
+	}, { PropertyOffsetInternal });
 
-	Off::EnumProperty::Base = OffsetFinder::FindEnumPropertyBaseOffset();
-	std::cerr << std::format("Off::EnumProperty::Base: 0x{:X}\n", Off::EnumProperty::Base) << std::endl;
+	const auto PropertySize = InitGraph.AddTask("Off::InSDK::Properties::PropertySize", [&]()
+	{
+		if (Off::EnumProperty::Base == OffsetFinder::OffsetNotFound)
+		{
+			Off::InSDK::Properties::PropertySize = Off::BoolProperty::Base;
+			Off::EnumProperty::Base = Off::BoolProperty::Base;
+		}
+		else
+		{
+			Off::InSDK::Properties::PropertySize = Off::EnumProperty::Base;
+		}
 
+		std::cerr << std::format("UPropertySize: 0x{:X}\n\n", Off::InSDK::Properties::PropertySize);
+	}, { BoolPropertyBase, EnumPropertyBase });
 
-	if (Off::EnumProperty::Base == OffsetFinder::OffsetNotFound)
+	InitGraph.AddTask("Off::ObjectProperty::PropertyClass", [&]()
 	{
-		Off::InSDK::Properties::PropertySize = Off::BoolProperty::Base;
-		Off::EnumProperty::Base = Off::BoolProperty::Base;
-	}
-	else
+		int32 PropertyClass = OffsetFinder::FindObjectPropertyClassOffset();
+		std::cerr << std::format("Off::ObjectProperty::PropertyClass: 0x{:X}\n", PropertyClass);
+		OverwriteIfInvalidOffset(PropertyClass, Off::InSDK::Properties::PropertySize);
+
+		Off::ObjectProperty::PropertyClass = PropertyClass;
+	}, { PropertySize });
+
+	InitGraph.AddTask("Off::ByteProperty::Enum", [&]()
 	{
-		Off::InSDK::Properties::PropertySize = Off::EnumProperty::Base;
-	}
+		int32 Enum = OffsetFinder::FindBytePropertyEnumOffset();
+		OverwriteIfInvalidOffset(Enum, Off::InSDK::Properties::PropertySize);
 
-	std::cerr << std::format("UPropertySize: 0x{:X}\n", Off::InSDK::Properties::PropertySize) << std::endl;
+		Off::ByteProperty::Enum = Enum;
+		std::cerr << std::format("Off::ByteProperty::Enum: 0x{:X}\n", Off::ByteProperty::Enum);
+	}, { PropertySize });
 
-	Off::ObjectProperty::PropertyClass = OffsetFinder::FindObjectPropertyClassOffset();
-	std::cerr << std::format("Off::ObjectProperty::PropertyClass: 0x{:X}", Off::ObjectProperty::PropertyClass) << std::endl;
-	OverwriteIfInvalidOffset(Off::ObjectProperty::PropertyClass, Off::InSDK::Properties::PropertySize);
+	InitGraph.AddTask("Off::StructProperty::Struct", [&]()
+	{
+		int32 Struct = OffsetFinder::FindStructPropertyStructOffset();
+		OverwriteIfInvalidOffset(Struct, Off::InSDK::Properties::PropertySize);
 
-	Off::ByteProperty::Enum = OffsetFinder::FindBytePropertyEnumOffset();
-	OverwriteIfInvalidOffset(Off::ByteProperty::Enum, Off::InSDK::Properties::PropertySize);
-	std::cerr << std::format("Off::ByteProperty::Enum: 0x{:X}", Off::ByteProperty::Enum) << std::endl;
+		Off::StructProperty::Struct = Struct;
+		std::cerr << std::format("Off::StructProperty::Struct: 0x{:X}\n\n", Off::StructProperty::Struct);
+	}, { PropertySize });
 
-	Off::StructProperty::Struct = OffsetFinder::FindStructPropertyStructOffset();
-	OverwriteIfInvalidOffset(Off::StructProperty::Struct, Off::InSDK::Properties::PropertySize);
-	std::cerr << std::format("Off::StructProperty::Struct: 0x{:X}\n", Off::StructProperty::Struct) << std::endl;
+	InitGraph.AddTask("Off::DelegateProperty::SignatureFunction", [&]()
+	{
+		int32 SignatureFunction = OffsetFinder::FindDelegatePropertySignatureFunctionOffset();
+		OverwriteIfInvalidOffset(SignatureFunction, Off::InSDK::Properties::PropertySize);
 
-	Off::DelegateProperty::SignatureFunction = OffsetFinder::FindDelegatePropertySignatureFunctionOffset();
-	OverwriteIfInvalidOffset(Off::DelegateProperty::SignatureFunction, Off::InSDK::Properties::PropertySize);
-	std::cerr << std::format("Off::DelegateProperty::SignatureFunction: 0x{:X}\n", Off::DelegateProperty::SignatureFunction) << std::endl;
+		Off::DelegateProperty::SignatureFunction = SignatureFunction;
+		std::cerr << std::format("Off::DelegateProperty::SignatureFunction: 0x{:X}\n\n", Off::DelegateProperty::SignatureFunction);
+	}, { PropertySize });
 
-	Off::ArrayProperty::Inner = OffsetFinder::FindInnerTypeOffset(Off::InSDK::Properties::PropertySize);
-	std::cerr << std::format("Off::ArrayProperty::Inner: 0x{:X}\n", Off::ArrayProperty::Inner);
+	InitGraph.AddTask("Off::ArrayProperty::Inner", [&]()
+	{
+		Off::ArrayProperty::Inner = OffsetFinder::FindInnerTypeOffset(Off::InSDK::Properties::PropertySize);
+		std::cerr << std::format("Off::ArrayProperty::Inner: 0x{:X}\n", Off::ArrayProperty::Inner);
+	}, { PropertySize });
 
-	Off::SetProperty::ElementProp = OffsetFinder::FindSetPropertyBaseOffset(Off::InSDK::Properties::PropertySize);
-	std::cerr << std::format("Off::SetProperty::ElementProp: 0x{:X}\n", Off::SetProperty::ElementProp);
+	InitGraph.AddTask("Off::SetProperty::ElementProp", [&]()
+	{
+		Off::SetProperty::ElementProp = OffsetFinder::FindSetPropertyBaseOffset(Off::InSDK::Properties::PropertySize);
+		std::cerr << std::format("Off::SetProperty::ElementProp: 0x{:X}\n", Off::SetProperty::ElementProp);
+	}, { PropertySize });
 
-	Off::MapProperty::Base = OffsetFinder::FindMapPropertyBaseOffset(Off::InSDK::Properties::PropertySize);
-	std::cerr << std::format("Off::MapProperty::Base: 0x{:X}\n", Off::MapProperty::Base) << std::endl;
+	InitGraph.AddTask("Off::MapProperty::Base", [&]()
+	{
+		Off::MapProperty::Base = OffsetFinder::FindMapPropertyBaseOffset(Off::InSDK::Properties::PropertySize);
+		std::cerr << std::format("Off::MapProperty::Base: 0x{:X}\n\n", Off::MapProperty::Base);
+	}, { PropertySize });
 
-	Off::InSDK::ULevel::Actors = OffsetFinder::FindLevelActorsOffset();
-	std::cerr << std::format("Off::InSDK::ULevel::Actors: 0x{:X}\n", Off::InSDK::ULevel::Actors) << std::endl;
+	InitGraph.AddTask("Off::InSDK::ULevel::Actors", [&]()
+	{
+		Off::InSDK::ULevel::Actors = OffsetFinder::FindLevelActorsOffset();
+		std::cerr << std::format("Off::InSDK::ULevel::Actors: 0x{:X}\n\n", Off::InSDK::ULevel::Actors);
+	}, { PropertyOffsetInternal, UStructSize });
 
-	Off::InSDK::UDataTable::RowMap = OffsetFinder::FindDatatableRowMapOffset();
-	std::cerr << std::format("Off::InSDK::UDataTable::RowMap: 0x{:X}\n", Off::InSDK::UDataTable::RowMap) << std::endl;
+	InitGraph.AddTask("Off::InSDK::UDataTable::RowMap", [&]()
+	{
+		Off::InSDK::UDataTable::RowMap = OffsetFinder::FindDatatableRowMapOffset();
+		std::cerr << std::format("Off::InSDK::UDataTable::RowMap: 0x{:X}\n\n", Off::InSDK::UDataTable::RowMap);
+	}, { PropertyOffsetInternal, PropertyElementSize });
+
+	const auto InitStartTime = std::chrono::high_resolution_clock::now();
+
+	InitGraph.Run();
+
+	std::chrono::duration<double, std::milli> InitTime = std::chrono::high_resolution_clock::now() - InitStartTime;
+
+	for (const TaskGraph::TaskTiming& Timing : InitGraph.GetTimings())
+		Profiler::AddPhase("Off::Init", Timing.Name, Timing.StartTime, Timing.EndTime);
 
+	InitGraph.PrintTimings("Off::Init");
+	std::cerr << std::format("Finding offsets took ({:.2f}ms)\n\n", InitTime.count());
+
+	/* Changes the FName settings all of the tasks above read names with, so it runs once they have all finished */
 	OffsetFinder::PostInitFNameSettings();
 
 	std::cerr << std::endl;
@@ -442,9 +631,17 @@ void Off::Init()
 
 void PropertySizes::Init()
 {
-	InitTDelegateSize();
-	InitFFieldPathSize();
-	InitTMulticastInlineDelegateSize();
+	/* Each of these only writes its own size and reads offsets that Off::Init() has already published */
+	TaskGraph InitGraph;
+
+	InitGraph.AddTask("PropertySizes::InitTDelegateSize", &InitTDelegateSize);
+	InitGraph.AddTask("PropertySizes::InitFFieldPathSize", &InitFFieldPathSize);
+	InitGraph.AddTask("PropertySizes::InitTMulticastInlineDelegateSize", &InitTMulticastInlineDelegateSize);
+
+	InitGraph.Run();
+
+	for (const TaskGraph::TaskTiming& Timing : InitGraph.GetTimings())
+		Profiler::AddPhase("Off::Init", Timing.Name, Timing.StartTime, Timing.EndTime);
 }
 
 void PropertySizes::InitTDelegateSize()
@@ -532,7 +729,7 @@ void PropertySizes::InitTMulticastInlineDelegateSize()
 				{
 					if (Prop.IsA(EClassCastFlags::MulticastInlineDelegateProperty))
 					{
-						PropertySizes::DelegateProperty = Prop.GetSize();
+						PropertySizes::MulticastInlineDelegateProperty = Prop.GetSize();
 						return;
 					}
 				}
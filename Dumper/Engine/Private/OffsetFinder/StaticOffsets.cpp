@@ -0,0 +1,159 @@
+#include <format>
+#include <fstream>
+#include <filesystem>
+
+#include "Utils.h"
+
+#include "OffsetFinder/StaticOffsets.h"
+#include "OffsetFinder/Offsets.h"
+
+#include "Unreal/UnrealTypes.h"
+#include "Unreal/ObjectArray.h"
+
+#include "Platform.h"
+#include "Architecture.h"
+#include "Json/json.hpp"
+
+
+namespace
+{
+	/* Identifies a build of the game, relinking changes the timestamp and usually the size of the image */
+	struct ImageIdentity
+	{
+		uint32 TimeDateStamp;
+		uint32 SizeOfImage;
+	};
+
+	/* The headers of the static image are mapped as well, this works for both the file and the loaded module */
+	ImageIdentity GetImageIdentity()
+	{
+		const uintptr_t ImageBase = Platform::GetModuleBase();
+		const PIMAGE_NT_HEADERS NtHeaders = reinterpret_cast<PIMAGE_NT_HEADERS>(ImageBase + reinterpret_cast<PIMAGE_DOS_HEADER>(ImageBase)->e_lfanew);
+
+		return { NtHeaders->FileHeader.TimeDateStamp, NtHeaders->OptionalHeader.SizeOfImage };
+	}
+
+	int32 GetOffsetOrZero(const void* Address)
+	{
+		return Address ? static_cast<int32>(Platform::GetOffset(Address)) : 0x0;
+	}
+
+	/* Leaf-functions and jump-thunks have no unwind-info, an offset that isn't inside of any function is accepted */
+	bool IsPlausibleFunctionOffset(const int32 Offset, const uint32 SizeOfImage)
+	{
+		if (Offset <= 0x0 || static_cast<uint32>(Offset) >= SizeOfImage)
+			return false;
+
+		const uintptr_t Address = Platform::GetModuleBase() + Offset;
+		const FunctionIndex::FunctionRange Function = Architecture_x86_64::GetModuleFunctionIndex().FindContainingFunction(Address);
+
+		return !Function.IsValid() || Function.Start == Address;
+	}
+}
+
+bool StaticOffsets::Precompute(const std::string& ImagePath, const std::string& OutputPath)
+{
+	if (!Platform::LoadStaticImage(ImagePath))
+	{
+		std::cerr << std::format("\nDumper-7: Couldn't map '{}' for static analysis!\n", ImagePath) << std::endl;
+		return false;
+	}
+
+	const ImageIdentity Identity = GetImageIdentity();
+
+	AppendString = GetOffsetOrZero(CALL_PLATFORM_SPECIFIC_FUNCTION(FName::FindAppendString));
+	ProcessEvent = GetOffsetOrZero(CALL_PLATFORM_SPECIFIC_FUNCTION(Off::InSDK::ProcessEvent::FindPECandidateByString));
+	Conv_NameToString = GetOffsetOrZero(FindUnrealExecFunctionByString("Conv_NameToString"));
+
+	Platform::UnloadStaticImage();
+
+	std::cerr << std::format("AppendString: 0x{:X}\n", AppendString);
+	std::cerr << std::format("ProcessEvent-Candidate: 0x{:X}\n", ProcessEvent);
+	std::cerr << std::format("Conv_NameToString: 0x{:X}\n\n", Conv_NameToString);
+
+	nlohmann::json OffsetsJson;
+	OffsetsJson["TimeDateStamp"] = Identity.TimeDateStamp;
+	OffsetsJson["SizeOfImage"] = Identity.SizeOfImage;
+	OffsetsJson["AppendString"] = AppendString;
+	OffsetsJson["ProcessEvent"] = ProcessEvent;
+	OffsetsJson["Conv_NameToString"] = Conv_NameToString;
+
+	std::error_code Error;
+	std::filesystem::create_directories(std::filesystem::path(OutputPath).parent_path(), Error);
+
+	std::ofstream OffsetsFile(OutputPath);
+
+	if (!OffsetsFile.is_open())
+	{
+		std::cerr << std::format("\nDumper-7: Couldn't write the precomputed offsets to '{}'!\n", OutputPath) << std::endl;
+		return false;
+	}
+
+	OffsetsFile << OffsetsJson.dump(4);
+
+	return true;
+}
+
+bool StaticOffsets::LoadAndValidate(const std::string& Path)
+{
+	std::ifstream OffsetsFile(Path);
+
+	if (!OffsetsFile.is_open())
+	{
+		std::cerr << std::format("\nDumper-7: Precomputed offsets '{}' weren't found, searching for them instead.\n", Path) << std::endl;
+		return false;
+	}
+
+	const nlohmann::json OffsetsJson = nlohmann::json::parse(OffsetsFile, nullptr, /* allow_exceptions */ false);
+
+	if (!OffsetsJson.is_object())
+	{
+		std::cerr << std::format("\nDumper-7: Precomputed offsets '{}' are malformed, searching for them instead.\n", Path) << std::endl;
+		return false;
+	}
+
+	const ImageIdentity Identity = GetImageIdentity();
+
+	if (OffsetsJson.value("TimeDateStamp", uint32(0x0)) != Identity.TimeDateStamp || OffsetsJson.value("SizeOfImage", uint32(0x0)) != Identity.SizeOfImage)
+	{
+		std::cerr << "\nDumper-7: Precomputed offsets are for a different build of the game, searching for them instead.\n" << std::endl;
+		return false;
+	}
+
+	auto LoadFunctionOffset = [&](const char* Name) -> int32
+	{
+		const int32 Offset = OffsetsJson.value(Name, int32(0x0));
+
+		if (Offset != 0x0 && !IsPlausibleFunctionOffset(Offset, Identity.SizeOfImage))
+		{
+			std::cerr << std::format("Dumper-7: Precomputed {} (0x{:X}) isn't the start of a function, searching for it instead.\n", Name, Offset);
+			return 0x0;
+		}
+
+		return Offset;
+	};
+
+	AppendString = LoadFunctionOffset("AppendString");
+	ProcessEvent = LoadFunctionOffset("ProcessEvent");
+	Conv_NameToString = LoadFunctionOffset("Conv_NameToString");
+
+	return true;
+}
+
+int32 StaticOffsets::FindProcessEventIndex()
+{
+	if (ProcessEvent == 0x0)
+		return -1;
+
+	const void* ProcessEventAddr = reinterpret_cast<const void*>(Platform::GetModuleBase() + ProcessEvent);
+	void** Vft = *reinterpret_cast<void***>(ObjectArray::GetByIndex(0).GetAddress());
+
+	auto IsSameAddr = [ProcessEventAddr](const uint8_t* FuncAddress, [[maybe_unused]] int32_t Index) -> bool
+	{
+		return FuncAddress == ProcessEventAddr;
+	};
+
+	const auto [FuncPtr, FuncIdx] = Platform::IterateVTableFunctions(Vft, IsSameAddr);
+
+	return FuncPtr ? FuncIdx : -1;
+}
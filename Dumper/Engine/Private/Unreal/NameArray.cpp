@@ -6,6 +6,7 @@
 
 #include "Platform.h"
 #include "Architecture.h"
+#include "MemoryBackend.h"
 
 uint8* NameArray::GNames = nullptr;
 
@@ -294,7 +295,7 @@ bool NameArray::InitializeNamePool(uint8_t* NamePool)
 
 		uint8_t* ChunkPtr = reinterpret_cast<uint8_t*>(NamesArray) + 0x10;
 
-		return reinterpret_cast<uint8_t**>(ChunkPtr)[ChunkIdx] + InChunkOffset;
+		return Memory::Read<uint8_t*>(ChunkPtr + (ChunkIdx * sizeof(void*))) + InChunkOffset;
 	};
 
 	Settings::Internal::bUseNamePool = true;
@@ -675,17 +676,17 @@ void NameArray::PostInit()
 
 int32 NameArray::GetNumChunks()
 {
-	return *reinterpret_cast<int32*>(GNames + Off::NameArray::MaxChunkIndex);
+	return Memory::Read<int32>(GNames + Off::NameArray::MaxChunkIndex);
 }
 
 int32 NameArray::GetNumElements()
 {
-	return !Settings::Internal::bUseNamePool ? *reinterpret_cast<int32*>(GNames + Off::NameArray::NumElements) : 0;
+	return !Settings::Internal::bUseNamePool ? Memory::Read<int32>(GNames + Off::NameArray::NumElements) : 0;
 }
 
 int32 NameArray::GetByteCursor()
 {
-	return Settings::Internal::bUseNamePool ? *reinterpret_cast<int32*>(GNames + Off::NameArray::ByteCursor) : 0;
+	return Settings::Internal::bUseNamePool ? Memory::Read<int32>(GNames + Off::NameArray::ByteCursor) : 0;
 }
 
 FNameEntry NameArray::GetNameEntry(const void* Name)
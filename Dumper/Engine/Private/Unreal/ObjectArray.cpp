@@ -3,12 +3,17 @@
 #include <fstream>
 #include <format>
 #include <filesystem>
+#include <iterator>
+#include <mutex>
 
 #include "Unreal/ObjectArray.h"
+#include "Unreal/ObjectPathCache.h"
 #include "OffsetFinder/Offsets.h"
 #include "Utils.h"
+#include "TaskGraph.h"
 
 #include "Platform.h"
+#include "MemoryBackend.h"
 
 
 namespace fs = std::filesystem;
@@ -188,6 +193,58 @@ void ObjectArray::InitDecryption(uint8_t* (*DecryptionFunction)(void* ObjPtr), c
 {
 	DecryptPtr = DecryptionFunction;
 	DecryptionLambdaStr = DecryptionLambdaAsStr;
+
+	bUsesDecryption = true;
+
+	/* Decryption is usually set before Init(), which resolves 'ByIndex' itself */
+	if (GObjects)
+		ResolveByIndex();
+}
+
+template<bool bIsChunked, bool bIsDecrypted>
+void* ObjectArray::GetObjectPtrByIndex(int32 Index)
+{
+	if (Index < 0 || Index >= Num())
+		return nullptr;
+
+	const int32 ObjectsOffset = bIsChunked ? Off::FUObjectArray::ChunkedFixedLayout.ObjectsOffset : Off::FUObjectArray::FixedLayout.ObjectsOffset;
+
+	uint8* Items = Memory::Read<uint8*>(GObjects + ObjectsOffset);
+
+	if constexpr (bIsDecrypted)
+		Items = DecryptPtr(Items);
+
+	if constexpr (bIsChunked)
+	{
+		const int32 ChunkIndex = Index / NumElementsPerChunk;
+		Index = Index % NumElementsPerChunk;
+
+		Items = Memory::Read<uint8*>(Items + (ChunkIndex * sizeof(void*)));
+	}
+
+	return Memory::Read<void*>(Items + FUObjectItemInitialOffset + (Index * SizeOfFUObjectItem));
+}
+
+void ObjectArray::ResolveByIndex()
+{
+	if (Off::FUObjectArray::bIsChunked)
+	{
+		ByIndex = bUsesDecryption ? &GetObjectPtrByIndex<true, true> : &GetObjectPtrByIndex<true, false>;
+	}
+	else
+	{
+		ByIndex = bUsesDecryption ? &GetObjectPtrByIndex<false, true> : &GetObjectPtrByIndex<false, false>;
+	}
+}
+
+uint8* ObjectArray::GetChunkItems(int32 ChunkIndex)
+{
+	uint8* Items = DecryptPtr(Memory::Read<uint8*>(GObjects + Off::FUObjectArray::GetObjectsOffset()));
+
+	if (Off::FUObjectArray::bIsChunked)
+		Items = Memory::Read<uint8*>(Items + (ChunkIndex * sizeof(void*)));
+
+	return Items + FUObjectItemInitialOffset;
 }
 
 
@@ -265,15 +322,7 @@ void ObjectArray::Init(bool bScanAllMemory, const char* const ModuleName)
 
 			std::cerr << "Found FFixedUObjectArray GObjects at offset 0x" << std::hex << Off::InSDK::ObjArray::GObjects << "\n\n";
 
-			ByIndex = [](void* ObjectsArray, int32 Index, uint32 FUObjectItemSize, uint32 FUObjectItemOffset, uint32 PerChunk) -> void*
-			{
-				if (Index < 0 || Index > Num())
-					return nullptr;
-
-				uint8_t* ChunkPtr = DecryptPtr(*reinterpret_cast<uint8_t**>(ObjectsArray));
-
-				return *reinterpret_cast<void**>(ChunkPtr + FUObjectItemOffset + (Index * FUObjectItemSize));
-			};
+			ResolveByIndex();
 
 			uint8_t* FirstItem = DecryptPtr(*reinterpret_cast<uint8_t**>(GObjects + Off::FUObjectArray::GetObjectsOffset()));
 
@@ -293,21 +342,7 @@ void ObjectArray::Init(bool bScanAllMemory, const char* const ModuleName)
 
 			std::cerr << "Found FChunkedFixedUObjectArray GObjects at offset 0x" << std::hex << Off::InSDK::ObjArray::GObjects << "\n\n";
 
-			ByIndex = [](void* ObjectsArray, int32 Index, uint32 FUObjectItemSize, uint32 FUObjectItemOffset, uint32 PerChunk) -> void*
-			{
-				if (Index < 0 || Index > Num())
-					return nullptr;
-
-				const int32 ChunkIndex = Index / PerChunk;
-				const int32 InChunkIdx = Index % PerChunk;
-
-				uint8_t* ChunkPtr = DecryptPtr(*reinterpret_cast<uint8_t**>(ObjectsArray));
-
-				uint8_t* Chunk = reinterpret_cast<uint8_t**>(ChunkPtr)[ChunkIndex];
-				uint8_t* ItemPtr = Chunk + (InChunkIdx * FUObjectItemSize);
-
-				return *reinterpret_cast<void**>(ItemPtr + FUObjectItemOffset);
-			};
+			ResolveByIndex();
 			
 			uint8_t* ChunksPtr = DecryptPtr(*reinterpret_cast<uint8_t**>(GObjects + Off::FUObjectArray::GetObjectsOffset()));
 
@@ -341,15 +376,7 @@ void ObjectArray::Init(int32 GObjectsOffset, const FFixedUObjectArrayLayout& Obj
 	Off::FUObjectArray::bIsChunked = false;
 	Off::FUObjectArray::FixedLayout = ObjectArrayLayout.IsValid() ? ObjectArrayLayout : FFixedUObjectArrayLayouts[0];
 
-	ByIndex = [](void* ObjectsArray, int32 Index, uint32 FUObjectItemSize, uint32 FUObjectItemOffset, uint32 PerChunk) -> void*
-	{
-		if (Index < 0 || Index > Num())
-			return nullptr;
-
-		uint8_t* ItemPtr = *reinterpret_cast<uint8_t**>(ObjectsArray) + (Index * FUObjectItemSize);
-
-		return *reinterpret_cast<void**>(ItemPtr + FUObjectItemOffset);
-	};
+	ResolveByIndex();
 
 	uint8_t* ChunksPtr = DecryptPtr(*reinterpret_cast<uint8_t**>(GObjects + Off::FUObjectArray::GetObjectsOffset()));
 
@@ -369,19 +396,7 @@ void ObjectArray::Init(int32 GObjectsOffset, int32 ElementsPerChunk, const FChun
 	NumElementsPerChunk = ElementsPerChunk;
 	Off::InSDK::ObjArray::ChunkSize = ElementsPerChunk;
 
-	ByIndex = [](void* ObjectsArray, int32 Index, uint32 FUObjectItemSize, uint32 FUObjectItemOffset, uint32 PerChunk) -> void*
-	{
-		if (Index < 0 || Index > Num())
-			return nullptr;
-
-		const int32 ChunkIndex = Index / PerChunk;
-		const int32 InChunkIdx = Index % PerChunk;
-
-		uint8_t* Chunk = (*reinterpret_cast<uint8_t***>(ObjectsArray))[ChunkIndex];
-		uint8_t* ItemPtr = reinterpret_cast<uint8_t*>(Chunk) + (InChunkIdx * FUObjectItemSize);
-
-		return *reinterpret_cast<void**>(ItemPtr + FUObjectItemOffset);
-	};
+	ResolveByIndex();
 
 	uint8_t* ChunksPtr = DecryptPtr(*reinterpret_cast<uint8_t**>(GObjects + Off::FUObjectArray::GetObjectsOffset()));
 
@@ -390,85 +405,115 @@ void ObjectArray::Init(int32 GObjectsOffset, int32 ElementsPerChunk, const FChun
 	ObjectArray::InitializeFUObjectItem(*reinterpret_cast<uint8_t**>(ChunksPtr));
 }
 
-void ObjectArray::DumpObjects(const fs::path& Path, bool bWithPathname)
+/*
+* The objects are formatted in blocks on all threads, each with its own ObjectPathCache. Blocks are written to the file strictly in order by
+* whichever thread completes the next one, so the file is identical to a single-threaded dump and only out-of-order blocks are kept in memory.
+*/
+static void DumpObjectsInParallel(const fs::path& FilePath, bool bWithPathname, bool bWithProperties)
 {
-	std::ofstream DumpStream(Path / "GObjects-Dump.txt");
+	constexpr int32 ObjectsPerBlock = 0x4000;
+
+	std::ofstream DumpStream(FilePath);
+
+	const int32 NumObjects = ObjectArray::Num();
 
 	DumpStream << "Object dump by Dumper-7\n\n";
 	DumpStream << (!Settings::Generator::GameVersion.empty() && !Settings::Generator::GameName.empty() ? (Settings::Generator::GameVersion + '-' + Settings::Generator::GameName) + "\n\n" : "");
-	DumpStream << "Count: " << Num() << "\n\n\n";
+	DumpStream << "Count: " << NumObjects << "\n\n\n";
 
-	for (auto Object : ObjectArray())
-	{
-		if (!bWithPathname)
-		{
-			DumpStream << std::format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetFullName());
-		}
-		else
-		{
-			DumpStream << std::format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetPathName());
-		}
-	}
+	const size_t NumBlocks = (static_cast<size_t>(NumObjects) + ObjectsPerBlock - 1) / ObjectsPerBlock;
 
-	DumpStream.close();
-}
+	struct FormattedBlock
+	{
+		std::string Text;
+		bool bIsFormatted = false;
+	};
 
-void ObjectArray::DumpObjectsWithProperties(const fs::path& Path, bool bWithPathname)
-{
-	std::ofstream DumpStream(Path / "GObjects-Dump-WithProperties.txt");
+	std::vector<FormattedBlock> Blocks(NumBlocks);
 
-	DumpStream << "Object dump by Dumper-7\n\n";
-	DumpStream << (!Settings::Generator::GameVersion.empty() && !Settings::Generator::GameName.empty() ? (Settings::Generator::GameVersion + '-' + Settings::Generator::GameName) + "\n\n" : "");
-	DumpStream << "Count: " << Num() << "\n\n\n";
+	std::mutex WriteMutex;
+	size_t NextBlockToWrite = 0x0;
 
-	for (auto Object : ObjectArray())
+	ParallelFor(NumBlocks, [&](size_t BlockIdx) -> void
 	{
-		if (!bWithPathname)
-		{
-			DumpStream << std::format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetFullName());
-		}
-		else
-		{
-			DumpStream << std::format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetPathName());
-		}
+		ObjectPathCache PathCache(bWithPathname);
+
+		const int32 StartIndex = static_cast<int32>(BlockIdx) * ObjectsPerBlock;
+		const int32 EndIndex = (StartIndex + ObjectsPerBlock) < NumObjects ? (StartIndex + ObjectsPerBlock) : NumObjects;
 
-		if (Object.IsA(EClassCastFlags::Struct))
+		std::string Text;
+		Text.reserve(static_cast<size_t>(ObjectsPerBlock) * 0x80);
+
+		for (int32 i = StartIndex; i < EndIndex; i++)
 		{
+			UEObject Object = ObjectArray::GetByIndex(i);
+
+			if (!Object)
+				continue;
+
+			std::format_to(std::back_inserter(Text), "[{:08X}] {{{}}} ", Object.GetIndex(), Object.GetAddress());
+			PathCache.AppendName(Text, Object);
+			Text += '\n';
+
+			if (!bWithProperties || !Object.IsA(EClassCastFlags::Struct))
+				continue;
+
 			for (UEProperty Prop : Object.Cast<UEStruct>().GetProperties())
 			{
-				DumpStream << std::format("[{:08X}] {{{}}}     {} {}\n", Prop.GetOffset(), Prop.GetAddress(), Prop.GetPropClassName(), Prop.GetName());
+				std::format_to(std::back_inserter(Text), "[{:08X}] {{{}}}     {} {}\n", Prop.GetOffset(), Prop.GetAddress(), Prop.GetPropClassName(), Prop.GetName());
 			}
 		}
-	}
+
+		std::scoped_lock Lock(WriteMutex);
+
+		Blocks[BlockIdx].Text = std::move(Text);
+		Blocks[BlockIdx].bIsFormatted = true;
+
+		for (; NextBlockToWrite < NumBlocks && Blocks[NextBlockToWrite].bIsFormatted; NextBlockToWrite++)
+		{
+			DumpStream.write(Blocks[NextBlockToWrite].Text.data(), Blocks[NextBlockToWrite].Text.size());
+			Blocks[NextBlockToWrite].Text = std::string();
+		}
+	});
 
 	DumpStream.close();
 }
 
+void ObjectArray::DumpObjects(const fs::path& Path, bool bWithPathname)
+{
+	DumpObjectsInParallel(Path / "GObjects-Dump.txt", bWithPathname, false);
+}
+
+void ObjectArray::DumpObjectsWithProperties(const fs::path& Path, bool bWithPathname)
+{
+	DumpObjectsInParallel(Path / "GObjects-Dump-WithProperties.txt", bWithPathname, true);
+}
+
 
 int32 ObjectArray::Num()
 {
-	return *reinterpret_cast<int32*>(GObjects + Off::FUObjectArray::GetNumElementsOffset());
+	return Memory::Read<int32>(GObjects + Off::FUObjectArray::GetNumElementsOffset());
 }
 
 int32 ObjectArray::Max()
 {
-	return *reinterpret_cast<int32*>(GObjects + Off::FUObjectArray::GetMaxElementsOffset());
+	return Memory::Read<int32>(GObjects + Off::FUObjectArray::GetMaxElementsOffset());
 }
 
 int32 ObjectArray::NumChunks()
 {
-	return *reinterpret_cast<int32*>(GObjects + Off::FUObjectArray::GetNumChunksOffset());
+	return Memory::Read<int32>(GObjects + Off::FUObjectArray::GetNumChunksOffset());
 }
 
 int32 ObjectArray::MaxChunks()
 {
-	return *reinterpret_cast<int32*>(GObjects + Off::FUObjectArray::GetMaxChunksOffset());
+	return Memory::Read<int32>(GObjects + Off::FUObjectArray::GetMaxChunksOffset());
 }
 
 template<typename UEType>
 static UEType ObjectArray::GetByIndex(int32 Index)
 {
-	return UEType(ByIndex(GObjects + Off::FUObjectArray::GetObjectsOffset(), Index, SizeOfFUObjectItem, FUObjectItemInitialOffset, NumElementsPerChunk));
+	return UEType(ByIndex(Index));
 }
 
 template<typename UEType>
@@ -548,8 +593,18 @@ ObjectArray::ObjectsIterator ObjectArray::end()
 
 
 ObjectArray::ObjectsIterator::ObjectsIterator(int32 StartIndex)
-	: CurrentIndex(StartIndex), CurrentObject(ObjectArray::GetByIndex(StartIndex))
+	: CurrentIndex(StartIndex), NumObjects(ObjectArray::Num())
 {
+	if (StartIndex < 0 || IsEnd())
+		return;
+
+	ElementsPerChunk = Off::FUObjectArray::bIsChunked ? NumElementsPerChunk : INT32_MAX;
+
+	ChunkIndex = StartIndex / ElementsPerChunk;
+	IndexInChunk = StartIndex % ElementsPerChunk;
+
+	CurrentChunkItems = ObjectArray::GetChunkItems(ChunkIndex);
+	CurrentObject = Memory::Read<void*>(CurrentChunkItems + (IndexInChunk * SizeOfFUObjectItem));
 }
 
 UEObject ObjectArray::ObjectsIterator::operator*() const
@@ -559,27 +614,38 @@ UEObject ObjectArray::ObjectsIterator::operator*() const
 
 ObjectArray::ObjectsIterator& ObjectArray::ObjectsIterator::operator++()
 {
-	CurrentObject = ObjectArray::GetByIndex(++CurrentIndex);
-
-	while (!CurrentObject && CurrentIndex < (ObjectArray::Num() - 1))
+	/* Skips empty slots in the array */
+	do
 	{
-		CurrentObject = ObjectArray::GetByIndex(++CurrentIndex);
-	}
+		if (++CurrentIndex >= NumObjects)
+		{
+			CurrentIndex = NumObjects;
+			CurrentObject = UEObject();
+			break;
+		}
+
+		if (++IndexInChunk == ElementsPerChunk) [[unlikely]]
+		{
+			IndexInChunk = 0x0;
+			CurrentChunkItems = ObjectArray::GetChunkItems(++ChunkIndex);
+		}
+
+		CurrentObject = Memory::Read<void*>(CurrentChunkItems + (IndexInChunk * SizeOfFUObjectItem));
 
-	if (!CurrentObject && CurrentIndex == (ObjectArray::Num() - 1)) [[unlikely]]
-		CurrentIndex++;
+	} while (!CurrentObject);
 
 	return *this;
 }
 
 bool ObjectArray::ObjectsIterator::operator==(const ObjectsIterator& Other) const
 {
-	return CurrentIndex == Other.CurrentIndex;
+	/* Iterators past their own end are equal, in case Num() changed between the creation of begin() and end() */
+	return CurrentIndex == Other.CurrentIndex || (IsEnd() && Other.IsEnd());
 }
 
 bool ObjectArray::ObjectsIterator::operator!=(const ObjectsIterator& Other) const
 {
-	return CurrentIndex != Other.CurrentIndex;
+	return !(*this == Other);
 }
 
 int32 ObjectArray::ObjectsIterator::GetIndex() const
@@ -0,0 +1,71 @@
+#include "Unreal/ObjectPathCache.h"
+
+
+ObjectPathCache::ObjectPathCache(bool bUsePathnames)
+	: bWithPathname(bUsePathnames)
+{
+}
+
+std::string ObjectPathCache::GetObjectName(UEObject Object) const
+{
+	return bWithPathname ? Object.GetNameWithPath() : Object.GetName();
+}
+
+const ObjectPathCache::CachedPath& ObjectPathCache::GetOrAddPath(UEObject Object)
+{
+	const int32 Index = Object.GetIndex();
+
+	if (auto It = Paths.find(Index); It != Paths.end())
+		return It->second;
+
+	CachedPath NewPath;
+
+	/* Resolve the outer first, the arena only grows so the offsets stay valid */
+	if (UEObject Outer = Object.GetOuter())
+	{
+		const CachedPath OuterPath = GetOrAddPath(Outer);
+
+		NewPath.Offset = Arena.size();
+		Arena.append(Arena, OuterPath.Offset, OuterPath.Length);
+		Arena += '.';
+	}
+	else
+	{
+		NewPath.Offset = Arena.size();
+	}
+
+	Arena += GetObjectName(Object);
+	NewPath.Length = static_cast<uint32>(Arena.size() - NewPath.Offset);
+
+	return Paths.emplace(Index, NewPath).first->second;
+}
+
+void ObjectPathCache::AppendName(std::string& OutName, UEObject Object)
+{
+	if (!Object)
+	{
+		OutName += "None";
+		return;
+	}
+
+	OutName += GetObjectName(Object.GetClass());
+	OutName += ' ';
+
+	if (UEObject Outer = Object.GetOuter())
+	{
+		const CachedPath& OuterPath = GetOrAddPath(Outer);
+
+		OutName.append(Arena, OuterPath.Offset, OuterPath.Length);
+		OutName += '.';
+	}
+
+	OutName += GetObjectName(Object);
+}
+
+std::string ObjectPathCache::GetName(UEObject Object)
+{
+	std::string Name;
+	AppendName(Name, Object);
+
+	return Name;
+}
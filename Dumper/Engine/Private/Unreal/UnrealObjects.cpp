@@ -1,8 +1,10 @@
 #include <format>
+#include <mutex>
 
 #include "Unreal/UnrealObjects.h"
 #include "Unreal/ObjectArray.h"
 #include "OffsetFinder/Offsets.h"
+#include "MemoryBackend.h"
 
 
 void* UEFFieldClass::GetAddress()
@@ -17,22 +19,22 @@ UEFFieldClass::operator bool() const
 
 EFieldClassID UEFFieldClass::GetId() const
 {
-	return *reinterpret_cast<EFieldClassID*>(Class + Off::FFieldClass::Id);
+	return Memory::Read<EFieldClassID>(Class + Off::FFieldClass::Id);
 }
 
 EClassCastFlags UEFFieldClass::GetCastFlags() const
 {
-	return *reinterpret_cast<EClassCastFlags*>(Class + Off::FFieldClass::CastFlags);
+	return Memory::Read<EClassCastFlags>(Class + Off::FFieldClass::CastFlags);
 }
 
 EClassFlags UEFFieldClass::GetClassFlags() const
 {
-	return *reinterpret_cast<EClassFlags*>(Class + Off::FFieldClass::ClassFlags);
+	return Memory::Read<EClassFlags>(Class + Off::FFieldClass::ClassFlags);
 }
 
 UEFFieldClass UEFFieldClass::GetSuper() const
 {
-	return UEFFieldClass(*reinterpret_cast<void**>(Class + Off::FFieldClass::SuperClass));
+	return UEFFieldClass(Memory::Read<void*>(Class + Off::FFieldClass::SuperClass));
 }
 
 FName UEFFieldClass::GetFName() const
@@ -73,7 +75,7 @@ const void* UEFField::GetAddress() const
 
 EObjectFlags UEFField::GetFlags() const
 {
-	return *reinterpret_cast<EObjectFlags*>(Field + Off::FField::Flags);
+	return Memory::Read<EObjectFlags>(Field + Off::FField::Flags);
 }
 
 class UEObject UEFField::GetOwnerAsUObject() const
@@ -81,9 +83,9 @@ class UEObject UEFField::GetOwnerAsUObject() const
 	if (IsOwnerUObject())
 	{
 		if (Settings::Internal::bUseMaskForFieldOwner)
-			return (void*)(*reinterpret_cast<uintptr_t*>(Field + Off::FField::Owner) & ~0x1ull);
+			return (void*)(Memory::Read<uintptr_t>(Field + Off::FField::Owner) & ~0x1ull);
 
-		return *reinterpret_cast<void**>(Field + Off::FField::Owner);
+		return Memory::Read<void*>(Field + Off::FField::Owner);
 	}
 
 	return nullptr;
@@ -92,7 +94,7 @@ class UEObject UEFField::GetOwnerAsUObject() const
 class UEFField UEFField::GetOwnerAsFField() const
 {
 	if (!IsOwnerUObject())
-		return *reinterpret_cast<void**>(Field + Off::FField::Owner);
+		return Memory::Read<void*>(Field + Off::FField::Owner);
 
 	return nullptr;
 }
@@ -111,7 +113,7 @@ class UEObject UEFField::GetOwnerUObject() const
 
 UEFFieldClass UEFField::GetClass() const
 {
-	return UEFFieldClass(*reinterpret_cast<void**>(Field + Off::FField::Class));
+	return UEFFieldClass(Memory::Read<void*>(Field + Off::FField::Class));
 }
 
 FName UEFField::GetFName() const
@@ -121,7 +123,7 @@ FName UEFField::GetFName() const
 
 UEFField UEFField::GetNext() const
 {
-	return UEFField(*reinterpret_cast<void**>(Field + Off::FField::Next));
+	return UEFField(Memory::Read<void*>(Field + Off::FField::Next));
 }
 
 std::vector<std::pair<std::string, std::string>> UEFField::GetMetaData() const
@@ -177,10 +179,10 @@ bool UEFField::IsOwnerUObject() const
 {
 	if (Settings::Internal::bUseMaskForFieldOwner)
 	{
-		return *reinterpret_cast<uintptr_t*>(Field + Off::FField::Owner) & 0x1;
+		return Memory::Read<uintptr_t>(Field + Off::FField::Owner) & 0x1;
 	}
 
-	return *reinterpret_cast<bool*>(Field + Off::FField::Owner + 0x8);
+	return Memory::Read<bool>(Field + Off::FField::Owner + 0x8);
 }
 
 bool UEFField::IsA(EClassCastFlags Flags) const
@@ -251,22 +253,22 @@ const void* UEObject::GetAddress() const
 
 void* UEObject::GetVft() const
 {
-	return *reinterpret_cast<void**>(Object);
+	return Memory::Read<void*>(Object);
 }
 
 EObjectFlags UEObject::GetFlags() const
 {
-	return *reinterpret_cast<EObjectFlags*>(Object + Off::UObject::Flags);
+	return Memory::Read<EObjectFlags>(Object + Off::UObject::Flags);
 }
 
 int32 UEObject::GetIndex() const
 {
-	return *reinterpret_cast<int32*>(Object + Off::UObject::Index);
+	return Memory::Read<int32>(Object + Off::UObject::Index);
 }
 
 UEClass UEObject::GetClass() const
 {
-	return UEClass(*reinterpret_cast<void**>(Object + Off::UObject::Class));
+	return UEClass(Memory::Read<void*>(Object + Off::UObject::Class));
 }
 
 FName UEObject::GetFName() const
@@ -276,7 +278,7 @@ FName UEObject::GetFName() const
 
 UEObject UEObject::GetOuter() const
 {
-	return UEObject(*reinterpret_cast<void**>(Object + Off::UObject::Outer));
+	return UEObject(Memory::Read<void*>(Object + Off::UObject::Outer));
 }
 
 int32 UEObject::GetPackageIndex() const
@@ -342,14 +344,9 @@ std::string UEObject::GetValidName() const
 
 std::string UEObject::GetCppName() const
 {
-	static UEClass ActorClass = nullptr;
-	static UEClass InterfaceClass = nullptr;
-
-	if (ActorClass == nullptr)
-		ActorClass = ObjectArray::FindClassFast("Actor");
-
-	if (InterfaceClass == nullptr)
-		InterfaceClass = ObjectArray::FindClassFast("Interface");
+	/* Initialization of function-local statics is thread-safe, the managers call this from multiple threads during Generator::InitInternal() */
+	static const UEClass ActorClass = ObjectArray::FindClassFast("Actor");
+	static const UEClass InterfaceClass = ObjectArray::FindClassFast("Interface");
 
 	std::string Temp = GetValidName();
 
@@ -370,21 +367,32 @@ std::string UEObject::GetCppName() const
 	return 'F' + Temp;
 }
 
+/* Appends "Outermost.[...].DirectOuter." to 'OutName'. Outers are collected first, prepending each one to the name is quadratic in the depth. */
+static void AppendOuterChain(std::string& OutName, UEObject DirectOuter, bool bWithPath)
+{
+	std::vector<UEObject> Outers;
+
+	for (UEObject Outer = DirectOuter; Outer; Outer = Outer.GetOuter())
+		Outers.push_back(Outer);
+
+	for (auto It = Outers.rbegin(); It != Outers.rend(); ++It)
+	{
+		OutName += bWithPath ? It->GetNameWithPath() : It->GetName();
+		OutName += '.';
+	}
+}
+
 std::string UEObject::GetFullName(int32& OutNameLength) const
 {
 	if (*this)
 	{
-		std::string Temp;
-
-		for (UEObject Outer = GetOuter(); Outer; Outer = Outer.GetOuter())
-		{
-			Temp = Outer.GetName() + '.' + Temp;
-		}
-
-		std::string Name = GetName();
-		OutNameLength = Name.size() + 1;
+		const std::string ObjectName = GetName();
+		OutNameLength = ObjectName.size() + 1;
 
-		Name = GetClass().GetName() + ' ' + Temp + Name;
+		std::string Name = GetClass().GetName();
+		Name += ' ';
+		AppendOuterChain(Name, GetOuter(), false);
+		Name += ObjectName;
 
 		return Name;
 	}
@@ -396,16 +404,9 @@ std::string UEObject::GetFullName() const
 {
 	if (*this)
 	{
-		std::string Temp;
-
-		for (UEObject Outer = GetOuter(); Outer; Outer = Outer.GetOuter())
-		{
-			Temp = Outer.GetName() + "." + Temp;
-		}
-
 		std::string Name = GetClass().GetName();
 		Name += " ";
-		Name += Temp;
+		AppendOuterChain(Name, GetOuter(), false);
 		Name += GetName();
 
 		return Name;
@@ -418,16 +419,9 @@ std::string UEObject::GetPathName() const
 {
 	if (*this)
 	{
-		std::string Temp;
-
-		for (UEObject Outer = GetOuter(); Outer; Outer = Outer.GetOuter())
-		{
-			Temp = Outer.GetNameWithPath() + "." + Temp;
-		}
-
 		std::string Name = GetClass().GetNameWithPath();
 		Name += " ";
-		Name += Temp;
+		AppendOuterChain(Name, GetOuter(), true);
 		Name += GetNameWithPath();
 
 		return Name;
@@ -473,7 +467,7 @@ void UEObject::ProcessEvent(UEFunction Func, void* Params)
 
 UEField UEField::GetNext() const
 {
-	return UEField(*reinterpret_cast<void**>(Object + Off::UField::Next));
+	return UEField(Memory::Read<void*>(Object + Off::UField::Next));
 }
 
 bool UEField::IsNextValid() const
@@ -503,7 +497,7 @@ std::vector<std::pair<FName, int64>> UEEnum::GetNameValuePairs() const
 	{
 		std::vector<std::pair<FName, int64>> Ret;
 
-		const uintptr_t TaggedNamesPtr = *reinterpret_cast<uintptr_t*>(Object + EnumNamesOffset);
+		const uintptr_t TaggedNamesPtr = Memory::Read<uintptr_t>(Object + EnumNamesOffset);
 		const bool bIsNamesPtrTagged = (TaggedNamesPtr & PointeFlagHasTag) != 0;
 		const uint8* NamesPtr = reinterpret_cast<uint8*>(TaggedNamesPtr & PointerMaskNoTag);
 
@@ -515,12 +509,12 @@ std::vector<std::pair<FName, int64>> UEEnum::GetNameValuePairs() const
 			exit(1);
 		}
 
-		const int64* Values = reinterpret_cast<int64*>(*reinterpret_cast<uintptr_t*>(Object + EnumNamesOffset + 0x8) & PointerMaskNoTag);
-		const int32 NumValues = *reinterpret_cast<int32*>(Object + EnumNamesOffset + 0x10);
+		const int64* Values = reinterpret_cast<int64*>(Memory::Read<uintptr_t>(Object + EnumNamesOffset + 0x8) & PointerMaskNoTag);
+		const int32 NumValues = Memory::Read<int32>(Object + EnumNamesOffset + 0x10);
 
 		for (uint32_t i = 0; i < NumValues; i++)
 		{
-			Ret.push_back({ FName(NamesPtr + (i * FNameSize)), Values[i] });
+			Ret.push_back({ FName(NamesPtr + (i * FNameSize)), Memory::Read<int64>(Values + i) });
 		}
 
 		return Ret;
@@ -620,27 +614,27 @@ std::string UEEnum::GetEnumTypeAsStr() const
 
 UEStruct UEStruct::GetSuper() const
 {
-	return UEStruct(*reinterpret_cast<void**>(Object + Off::UStruct::SuperStruct));
+	return UEStruct(Memory::Read<void*>(Object + Off::UStruct::SuperStruct));
 }
 
 UEField UEStruct::GetChild() const
 {
-	return UEField(*reinterpret_cast<void**>(Object + Off::UStruct::Children));
+	return UEField(Memory::Read<void*>(Object + Off::UStruct::Children));
 }
 
 UEFField UEStruct::GetChildProperties() const
 {
-	return UEFField(*reinterpret_cast<void**>(Object + Off::UStruct::ChildProperties));
+	return UEFField(Memory::Read<void*>(Object + Off::UStruct::ChildProperties));
 }
 
 int16 UEStruct::GetMinAlignment() const
 {
-	return *reinterpret_cast<int16*>(Object + Off::UStruct::MinAlignment);
+	return Memory::Read<int16>(Object + Off::UStruct::MinAlignment);
 }
 
 int32 UEStruct::GetStructSize() const
 {
-	return *reinterpret_cast<int32*>(Object + Off::UStruct::Size);
+	return Memory::Read<int32>(Object + Off::UStruct::Size);
 }
 
 bool UEStruct::HasType(UEStruct Type) const
@@ -747,7 +741,7 @@ bool UEStruct::HasMembers() const
 
 EClassCastFlags UEClass::GetCastFlags() const
 {
-	return *reinterpret_cast<EClassCastFlags*>(Object + Off::UClass::CastFlags);
+	return Memory::Read<EClassCastFlags>(Object + Off::UClass::CastFlags);
 }
 
 std::string UEClass::StringifyCastFlags() const
@@ -762,7 +756,7 @@ bool UEClass::IsType(EClassCastFlags TypeFlag) const
 
 UEObject UEClass::GetDefaultObject() const
 {
-	return UEObject(*reinterpret_cast<void**>(Object + Off::UClass::ClassDefaultObject));
+	return UEObject(Memory::Read<void*>(Object + Off::UClass::ClassDefaultObject));
 }
 
 TArray<FImplementedInterface> UEClass::GetImplementedInterfaces() const
@@ -792,7 +786,7 @@ UEFunction UEClass::GetFunction(const std::string& ClassName, const std::string&
 
 EFunctionFlags UEFunction::GetFunctionFlags() const
 {
-	return *reinterpret_cast<EFunctionFlags*>(Object + Off::UFunction::FunctionFlags);
+	return Memory::Read<EFunctionFlags>(Object + Off::UFunction::FunctionFlags);
 }
 
 bool UEFunction::HasFlags(EFunctionFlags FuncFlags) const
@@ -802,7 +796,7 @@ bool UEFunction::HasFlags(EFunctionFlags FuncFlags) const
 
 void* UEFunction::GetExecFunction() const
 {
-	return *reinterpret_cast<void**>(Object + Off::UFunction::ExecFunction);
+	return Memory::Read<void*>(Object + Off::UFunction::ExecFunction);
 }
 
 UEProperty UEFunction::GetReturnProperty() const
@@ -852,6 +846,75 @@ EClassCastFlags UEProperty::GetCastFlags() const
 	return Class ? Class.GetCastFlags() : FieldClass.GetCastFlags();
 }
 
+/* Tested in order, the first match wins. Flags that imply others (ClassProperty -> ObjectProperty) come before the ones they imply. */
+static constexpr std::pair<EClassCastFlags, EPropertyKind> PropertyKindsByPriority[] = {
+	{ EClassCastFlags::ByteProperty, EPropertyKind::Byte },
+	{ EClassCastFlags::UInt16Property, EPropertyKind::UInt16 },
+	{ EClassCastFlags::UInt32Property, EPropertyKind::UInt32 },
+	{ EClassCastFlags::UInt64Property, EPropertyKind::UInt64 },
+	{ EClassCastFlags::Int8Property, EPropertyKind::Int8 },
+	{ EClassCastFlags::Int16Property, EPropertyKind::Int16 },
+	{ EClassCastFlags::IntProperty, EPropertyKind::Int },
+	{ EClassCastFlags::Int64Property, EPropertyKind::Int64 },
+	{ EClassCastFlags::FloatProperty, EPropertyKind::Float },
+	{ EClassCastFlags::DoubleProperty, EPropertyKind::Double },
+	{ EClassCastFlags::ClassProperty, EPropertyKind::Class },
+	{ EClassCastFlags::NameProperty, EPropertyKind::Name },
+	{ EClassCastFlags::StrProperty, EPropertyKind::Str },
+	{ EClassCastFlags::TextProperty, EPropertyKind::Text },
+	{ EClassCastFlags::BoolProperty, EPropertyKind::Bool },
+	{ EClassCastFlags::StructProperty, EPropertyKind::Struct },
+	{ EClassCastFlags::ArrayProperty, EPropertyKind::Array },
+	{ EClassCastFlags::DelegateProperty, EPropertyKind::Delegate },
+	{ EClassCastFlags::WeakObjectProperty, EPropertyKind::WeakObject },
+	{ EClassCastFlags::LazyObjectProperty, EPropertyKind::LazyObject },
+	{ EClassCastFlags::SoftClassProperty, EPropertyKind::SoftClass },
+	{ EClassCastFlags::SoftObjectProperty, EPropertyKind::SoftObject },
+	{ EClassCastFlags::ObjectProperty, EPropertyKind::Object },
+	{ EClassCastFlags::ObjectPropertyBase, EPropertyKind::ObjectBase },
+	{ EClassCastFlags::MapProperty, EPropertyKind::Map },
+	{ EClassCastFlags::SetProperty, EPropertyKind::Set },
+	{ EClassCastFlags::EnumProperty, EPropertyKind::Enum },
+	{ EClassCastFlags::InterfaceProperty, EPropertyKind::Interface },
+	{ EClassCastFlags::FieldPathProperty, EPropertyKind::FieldPath },
+	{ EClassCastFlags::MulticastInlineDelegateProperty, EPropertyKind::MulticastInlineDelegate },
+	{ EClassCastFlags::MulticastSparseDelegateProperty, EPropertyKind::MulticastSparseDelegate },
+	{ EClassCastFlags::MulticastDelegateProperty, EPropertyKind::MulticastDelegate },
+	{ EClassCastFlags::OptionalProperty, EPropertyKind::Optional },
+	{ EClassCastFlags::Utf8StrProperty, EPropertyKind::Utf8Str },
+	{ EClassCastFlags::AnsiStrProperty, EPropertyKind::AnsiStr },
+};
+
+static EPropertyKind ClassifyPropertyCastFlags(EClassCastFlags Flags)
+{
+	for (const auto& [Flag, Kind] : PropertyKindsByPriority)
+	{
+		if (Flags & Flag)
+			return Kind;
+	}
+
+	return EPropertyKind::Unknown;
+}
+
+EPropertyKind UEProperty::GetPropertyKind() const
+{
+	/* There are only a few dozen property-classes and they never change while dumping */
+	thread_local std::unordered_map<const void*, EPropertyKind> KindsByClass;
+
+	auto [Class, FieldClass] = GetClass();
+
+	const void* ClassAddress = Class ? Class.GetAddress() : FieldClass.GetAddress();
+
+	auto It = KindsByClass.find(ClassAddress);
+
+	if (It != KindsByClass.end()) [[likely]]
+		return It->second;
+
+	const EClassCastFlags Flags = Class ? Class.GetCastFlags() : FieldClass.GetCastFlags();
+
+	return KindsByClass.emplace(ClassAddress, ClassifyPropertyCastFlags(Flags)).first->second;
+}
+
 UEProperty::operator bool() const
 {
 	return Base != nullptr && ((Base + Off::UObject::Class) != nullptr || (Base + Off::FField::Class) != nullptr);
@@ -879,24 +942,24 @@ FName UEProperty::GetFName() const
 int32 UEProperty::GetArrayDim() const
 {
 	if (Settings::Internal::bUseUint8ArrayDim)
-		return *reinterpret_cast<uint8*>(Base + Off::Property::ArrayDim);
+		return Memory::Read<uint8>(Base + Off::Property::ArrayDim);
 
-	return *reinterpret_cast<int32*>(Base + Off::Property::ArrayDim);
+	return Memory::Read<int32>(Base + Off::Property::ArrayDim);
 }
 
 int32 UEProperty::GetSize() const
 {
-	return *reinterpret_cast<int32*>(Base + Off::Property::ElementSize);
+	return Memory::Read<int32>(Base + Off::Property::ElementSize);
 }
 
 int32 UEProperty::GetOffset() const
 {
-	return *reinterpret_cast<int32*>(Base + Off::Property::Offset_Internal);
+	return Memory::Read<int32>(Base + Off::Property::Offset_Internal);
 }
 
 EPropertyFlags UEProperty::GetPropertyFlags() const
 {
-	return *reinterpret_cast<EPropertyFlags*>(Base + Off::Property::PropertyFlags);
+	return Memory::Read<EPropertyFlags>(Base + Off::Property::PropertyFlags);
 }
 
 bool UEProperty::HasPropertyFlags(EPropertyFlags PropertyFlag) const
@@ -921,131 +984,73 @@ std::string UEProperty::GetValidName() const
 
 int32 UEProperty::GetAlignment() const
 {
-	EClassCastFlags TypeFlags = (GetClass().first ? GetClass().first.GetCastFlags() : GetClass().second.GetCastFlags());
-
-	if (TypeFlags & EClassCastFlags::ByteProperty)
+	switch (GetPropertyKind())
 	{
+	case EPropertyKind::Byte:
 		return alignof(uint8); // 0x1
-	}
-	else if (TypeFlags & EClassCastFlags::UInt16Property)
-	{
+	case EPropertyKind::UInt16:
 		return alignof(uint16); // 0x2
-	}
-	else if (TypeFlags & EClassCastFlags::UInt32Property)
-	{
+	case EPropertyKind::UInt32:
 		return alignof(uint32); // 0x4
-	}
-	else if (TypeFlags & EClassCastFlags::UInt64Property)
-	{
+	case EPropertyKind::UInt64:
 		return sizeof(void*); // 0x4 on 32bit or 0x8 on 64bit
-	}
-	else if (TypeFlags & EClassCastFlags::Int8Property)
-	{
+	case EPropertyKind::Int8:
 		return alignof(int8); // 0x1
-	}
-	else if (TypeFlags & EClassCastFlags::Int16Property)
-	{
+	case EPropertyKind::Int16:
 		return alignof(int16); // 0x2
-	}
-	else if (TypeFlags & EClassCastFlags::IntProperty)
-	{
+	case EPropertyKind::Int:
 		return alignof(int32); // 0x4
-	}
-	else if (TypeFlags & EClassCastFlags::Int64Property)
-	{
+	case EPropertyKind::Int64:
 		return sizeof(void*); // 0x4 on 32bit or 0x8 on 64bit
-	}
-	else if (TypeFlags & EClassCastFlags::FloatProperty)
-	{
+	case EPropertyKind::Float:
 		return alignof(float); // 0x4
-	}
-	else if (TypeFlags & EClassCastFlags::DoubleProperty)
-	{
+	case EPropertyKind::Double:
 		return sizeof(void*); // 0x4 on 32bit or 0x8 on 64bit
-	}
-	else if (TypeFlags & EClassCastFlags::ClassProperty)
-	{
+	case EPropertyKind::Class:
 		return alignof(void*); // 0x4 / 0x8
-	}
-	else if (TypeFlags & EClassCastFlags::NameProperty)
-	{
+	case EPropertyKind::Name:
 		return alignof(int32); // FName is a bunch of int32s
-	}
-	else if (TypeFlags & EClassCastFlags::StrProperty)
-	{
+	case EPropertyKind::Str:
 		return alignof(FString); // 0x8
-	}
-	else if (TypeFlags & EClassCastFlags::TextProperty)
-	{
+	case EPropertyKind::Text:
 		return alignof(FString); // alignof member FString
-	}
-	else if (TypeFlags & EClassCastFlags::BoolProperty)
-	{
+	case EPropertyKind::Bool:
 		return alignof(bool); // 0x1
-	}
-	else if (TypeFlags & EClassCastFlags::StructProperty)
-	{
+	case EPropertyKind::Struct:
 		return Cast<UEStructProperty>().GetUnderlayingStruct().GetMinAlignment();
-	}
-	else if (TypeFlags & EClassCastFlags::ArrayProperty)
-	{
+	case EPropertyKind::Array:
 		return alignof(TArray<int>); // 0x8
-	}
-	else if (TypeFlags & EClassCastFlags::DelegateProperty)
-	{
+	case EPropertyKind::Delegate:
 		return alignof(int32); // 0x4
-	}
-	else if (TypeFlags & EClassCastFlags::WeakObjectProperty)
-	{
+	case EPropertyKind::WeakObject:
 		return alignof(int32); // TWeakObjectPtr is a bunch of int32s
-	}
-	else if (TypeFlags & EClassCastFlags::LazyObjectProperty)
-	{
+	case EPropertyKind::LazyObject:
 		return alignof(int32); // TLazyObjectPtr is a bunch of int32s
-	}
-	else if (TypeFlags & EClassCastFlags::SoftClassProperty)
-	{
+	case EPropertyKind::SoftClass:
 		return alignof(FString); // alignof member FString
-	}
-	else if (TypeFlags & EClassCastFlags::SoftObjectProperty)
-	{
+	case EPropertyKind::SoftObject:
 		return alignof(FString); // alignof member FString
-	}
-	else if (TypeFlags & EClassCastFlags::ObjectProperty)
-	{
+	case EPropertyKind::Object:
 		return alignof(void*); // 0x4 / 0x8
-	}
-	else if (TypeFlags & EClassCastFlags::MapProperty)
-	{
+	case EPropertyKind::Map:
 		return alignof(TArray<int>); // 0x8, TMap contains a TArray
-	}
-	else if (TypeFlags & EClassCastFlags::SetProperty)
-	{
+	case EPropertyKind::Set:
 		return alignof(TArray<int>); // 0x8, TSet contains a TArray
-	}
-	else if (TypeFlags & EClassCastFlags::EnumProperty)
+	case EPropertyKind::Enum:
 	{
 		UEProperty P = Cast<UEEnumProperty>().GetUnderlayingProperty();
 
 		return P ? P.GetAlignment() : 0x1;
 	}
-	else if (TypeFlags & EClassCastFlags::InterfaceProperty)
-	{
+	case EPropertyKind::Interface:
 		return alignof(void*); // 0x4 / 0x8
-	}
-	else if (TypeFlags & EClassCastFlags::FieldPathProperty)
-	{
+	case EPropertyKind::FieldPath:
 		return alignof(TArray<int>); // alignof member TArray<FName> and ptr;
-	}
-	else if (TypeFlags & EClassCastFlags::MulticastSparseDelegateProperty)
-	{
+	case EPropertyKind::MulticastSparseDelegate:
 		return 0x1; // size in PropertyFixup (alignment isn't greater than size)
-	}
-	else if (TypeFlags & EClassCastFlags::MulticastInlineDelegateProperty)
-	{
+	case EPropertyKind::MulticastInlineDelegate:
 		return alignof(TArray<int>);  // alignof member TArray<FName>
-	}
-	else if (TypeFlags & EClassCastFlags::OptionalProperty)
+	case EPropertyKind::Optional:
 	{
 		UEProperty ValueProperty = Cast<UEOptionalProperty>().GetValueProperty();
 
@@ -1055,10 +1060,14 @@ int32 UEProperty::GetAlignment() const
 
 		return  GetSize() - ValueProperty.GetSize();
 	}
+	default:
+		break;
+	}
 
 	if (Settings::Internal::bUseFProperty)
 	{
 		static std::unordered_map<void*, int32> UnknownProperties;
+		static std::mutex UnknownPropertiesMutex;
 
 		static auto TryFindPropertyRefInOptionalToGetAlignment = [](std::unordered_map<void*, int32>& OutProperties, void* PropertyClass) -> int32
 		{
@@ -1084,6 +1093,8 @@ int32 UEProperty::GetAlignment() const
 			return OutProperties.insert({ PropertyClass, 0x1 }).first->second;
 		};
 
+		std::scoped_lock Lock(UnknownPropertiesMutex);
+
 		auto It = UnknownProperties.find(GetClass().second.GetAddress());
 
 		/* Safe to use first member, as we're guaranteed to use FProperty */
@@ -1096,132 +1107,90 @@ int32 UEProperty::GetAlignment() const
 	return 0x1;
 }
 
-std::string UEProperty::GetCppType() const
+/* Container type-strings are built from their inner properties recursively, build each one only once per thread */
+template<typename BuildTypeFunctionType>
+static std::string GetCachedContainerCppType(const UEProperty& Property, BuildTypeFunctionType&& BuildType)
 {
-	EClassCastFlags TypeFlags = (GetClass().first ? GetClass().first.GetCastFlags() : GetClass().second.GetCastFlags());
+	thread_local std::unordered_map<const void*, std::string> TypesByProperty;
+
+	auto It = TypesByProperty.find(Property.GetAddress());
+
+	if (It != TypesByProperty.end())
+		return It->second;
+
+	/* Not inserted before building, 'BuildType' may recurse into this function and rehash the map */
+	std::string Type = BuildType();
 
-	if (TypeFlags & EClassCastFlags::ByteProperty)
+	return TypesByProperty.emplace(Property.GetAddress(), std::move(Type)).first->second;
+}
+
+std::string UEProperty::GetCppType() const
+{
+	switch (GetPropertyKind())
 	{
+	case EPropertyKind::Byte:
 		return Cast<UEByteProperty>().GetCppType();
-	}
-	else if (TypeFlags & EClassCastFlags::UInt16Property)
-	{
+	case EPropertyKind::UInt16:
 		return "uint16";
-	}
-	else if (TypeFlags & EClassCastFlags::UInt32Property)
-	{
+	case EPropertyKind::UInt32:
 		return "uint32";
-	}
-	else if (TypeFlags & EClassCastFlags::UInt64Property)
-	{
+	case EPropertyKind::UInt64:
 		return "uint64";
-	}
-	else if (TypeFlags & EClassCastFlags::Int8Property)
-	{
+	case EPropertyKind::Int8:
 		return "int8";
-	}
-	else if (TypeFlags & EClassCastFlags::Int16Property)
-	{
+	case EPropertyKind::Int16:
 		return "int16";
-	}
-	else if (TypeFlags & EClassCastFlags::IntProperty)
-	{
+	case EPropertyKind::Int:
 		return "int32";
-	}
-	else if (TypeFlags & EClassCastFlags::Int64Property)
-	{
+	case EPropertyKind::Int64:
 		return "int64";
-	}
-	else if (TypeFlags & EClassCastFlags::FloatProperty)
-	{
+	case EPropertyKind::Float:
 		return "float";
-	}
-	else if (TypeFlags & EClassCastFlags::DoubleProperty)
-	{
+	case EPropertyKind::Double:
 		return "double";
-	}
-	else if (TypeFlags & EClassCastFlags::ClassProperty)
-	{
+	case EPropertyKind::Class:
 		return Cast<UEClassProperty>().GetCppType();
-	}
-	else if (TypeFlags & EClassCastFlags::NameProperty)
-	{
+	case EPropertyKind::Name:
 		return "class FName";
-	}
-	else if (TypeFlags & EClassCastFlags::StrProperty)
-	{
+	case EPropertyKind::Str:
 		return "class FString";
-	}
-	else if (TypeFlags & EClassCastFlags::TextProperty)
-	{
+	case EPropertyKind::Text:
 		return "class FText";
-	}
-	else if (TypeFlags & EClassCastFlags::BoolProperty)
-	{
+	case EPropertyKind::Bool:
 		return Cast<UEBoolProperty>().GetCppType();
-	}
-	else if (TypeFlags & EClassCastFlags::StructProperty)
-	{
+	case EPropertyKind::Struct:
 		return Cast<UEStructProperty>().GetCppType();
-	}
-	else if (TypeFlags & EClassCastFlags::ArrayProperty)
-	{
-		return Cast<UEArrayProperty>().GetCppType();
-	}
-	else if (TypeFlags & EClassCastFlags::WeakObjectProperty)
-	{
+	case EPropertyKind::Array:
+		return GetCachedContainerCppType(*this, [this]() { return Cast<UEArrayProperty>().GetCppType(); });
+	case EPropertyKind::WeakObject:
 		return Cast<UEWeakObjectProperty>().GetCppType();
-	}
-	else if (TypeFlags & EClassCastFlags::LazyObjectProperty)
-	{
+	case EPropertyKind::LazyObject:
 		return Cast<UELazyObjectProperty>().GetCppType();
-	}
-	else if (TypeFlags & EClassCastFlags::SoftClassProperty)
-	{
+	case EPropertyKind::SoftClass:
 		return Cast<UESoftClassProperty>().GetCppType();
-	}
-	else if (TypeFlags & EClassCastFlags::SoftObjectProperty)
-	{
+	case EPropertyKind::SoftObject:
 		return Cast<UESoftObjectProperty>().GetCppType();
-	}
-	else if (TypeFlags & EClassCastFlags::ObjectProperty)
-	{
+	case EPropertyKind::Object:
 		return Cast<UEObjectProperty>().GetCppType();
-	}
-	else if (TypeFlags & EClassCastFlags::MapProperty)
-	{
-		return Cast<UEMapProperty>().GetCppType();
-	}
-	else if (TypeFlags & EClassCastFlags::SetProperty)
-	{
-		return Cast<UESetProperty>().GetCppType();
-	}
-	else if (TypeFlags & EClassCastFlags::EnumProperty)
-	{
+	case EPropertyKind::Map:
+		return GetCachedContainerCppType(*this, [this]() { return Cast<UEMapProperty>().GetCppType(); });
+	case EPropertyKind::Set:
+		return GetCachedContainerCppType(*this, [this]() { return Cast<UESetProperty>().GetCppType(); });
+	case EPropertyKind::Enum:
 		return Cast<UEEnumProperty>().GetCppType();
-	}
-	else if (TypeFlags & EClassCastFlags::InterfaceProperty)
-	{
+	case EPropertyKind::Interface:
 		return Cast<UEInterfaceProperty>().GetCppType();
-	}
-	else if (TypeFlags & EClassCastFlags::FieldPathProperty)
-	{
+	case EPropertyKind::FieldPath:
 		if (Settings::Internal::bIsObjPtrInsteadOfFieldPathProperty)
 			return Cast<UEObjectProperty>().GetCppType();
 
 		return Cast<UEFieldPathProperty>().GetCppType();
-	}
-	else if (TypeFlags & EClassCastFlags::DelegateProperty)
-	{
+	case EPropertyKind::Delegate:
 		return Cast<UEDelegateProperty>().GetCppType();
-	}
-	else if (TypeFlags & EClassCastFlags::OptionalProperty)
-	{
+	case EPropertyKind::Optional:
 		return Cast<UEOptionalProperty>().GetCppType();
-	}
-	else
-	{
-		return (GetClass().first ? GetClass().first.GetCppName() : GetClass().second.GetCppName()) + "_";;
+	default:
+		return (GetClass().first ? GetClass().first.GetCppName() : GetClass().second.GetCppName()) + "_";
 	}
 }
 
@@ -1237,7 +1206,7 @@ std::string UEProperty::StringifyFlags() const
 
 UEEnum UEByteProperty::GetEnum() const
 {
-	return UEEnum(*reinterpret_cast<void**>(Base + Off::ByteProperty::Enum));
+	return UEEnum(Memory::Read<void*>(Base + Off::ByteProperty::Enum));
 }
 
 std::string UEByteProperty::GetCppType() const
@@ -1293,7 +1262,7 @@ std::string UEBoolProperty::GetCppType() const
 
 UEClass UEObjectProperty::GetPropertyClass() const
 {
-	return UEClass(*reinterpret_cast<void**>(Base + Off::ObjectProperty::PropertyClass));
+	return UEClass(Memory::Read<void*>(Base + Off::ObjectProperty::PropertyClass));
 }
 
 std::string UEObjectProperty::GetCppType() const
@@ -1303,7 +1272,7 @@ std::string UEObjectProperty::GetCppType() const
 
 UEClass UEClassProperty::GetMetaClass() const
 {
-	return UEClass(*reinterpret_cast<void**>(Base + Off::ClassProperty::MetaClass));
+	return UEClass(Memory::Read<void*>(Base + Off::ClassProperty::MetaClass));
 }
 
 std::string UEClassProperty::GetCppType() const
@@ -1338,7 +1307,7 @@ std::string UEInterfaceProperty::GetCppType() const
 
 UEStruct UEStructProperty::GetUnderlayingStruct() const
 {
-	return UEStruct(*reinterpret_cast<void**>(Base + Off::StructProperty::Struct));
+	return UEStruct(Memory::Read<void*>(Base + Off::StructProperty::Struct));
 }
 
 std::string UEStructProperty::GetCppType() const
@@ -1348,7 +1317,7 @@ std::string UEStructProperty::GetCppType() const
 
 UEProperty UEArrayProperty::GetInnerProperty() const
 {
-	return UEProperty(*reinterpret_cast<void**>(Base + Off::ArrayProperty::Inner));
+	return UEProperty(Memory::Read<void*>(Base + Off::ArrayProperty::Inner));
 }
 
 std::string UEArrayProperty::GetCppType() const
@@ -1358,7 +1327,7 @@ std::string UEArrayProperty::GetCppType() const
 
 UEFunction UEDelegateProperty::GetSignatureFunction() const
 {
-	return UEFunction(*reinterpret_cast<void**>(Base + Off::DelegateProperty::SignatureFunction));
+	return UEFunction(Memory::Read<void*>(Base + Off::DelegateProperty::SignatureFunction));
 }
 
 std::string UEDelegateProperty::GetCppType() const
@@ -1369,7 +1338,7 @@ std::string UEDelegateProperty::GetCppType() const
 UEFunction UEMulticastInlineDelegateProperty::GetSignatureFunction() const
 {
 	// Uses "Off::DelegateProperty::SignatureFunction" on purpose
-	return UEFunction(*reinterpret_cast<void**>(Base + Off::DelegateProperty::SignatureFunction));
+	return UEFunction(Memory::Read<void*>(Base + Off::DelegateProperty::SignatureFunction));
 }
 
 std::string UEMulticastInlineDelegateProperty::GetCppType() const
@@ -1394,7 +1363,7 @@ std::string UEMapProperty::GetCppType() const
 
 UEProperty UESetProperty::GetElementProperty() const
 {
-	return UEProperty(*reinterpret_cast<void**>(Base + Off::SetProperty::ElementProp));
+	return UEProperty(Memory::Read<void*>(Base + Off::SetProperty::ElementProp));
 }
 
 std::string UESetProperty::GetCppType() const
@@ -1422,7 +1391,7 @@ std::string UEEnumProperty::GetCppType() const
 
 UEFFieldClass UEFieldPathProperty::GetFieldClass() const
 {
-	return UEFFieldClass(*reinterpret_cast<void**>(Base + Off::FieldPathProperty::FieldClass));
+	return UEFFieldClass(Memory::Read<void*>(Base + Off::FieldPathProperty::FieldClass));
 }
 
 std::string UEFieldPathProperty::GetCppType() const
@@ -1432,7 +1401,7 @@ std::string UEFieldPathProperty::GetCppType() const
 
 UEProperty UEOptionalProperty::GetValueProperty() const
 {
-	return UEProperty(*reinterpret_cast<void**>(Base + Off::OptionalProperty::ValueProperty));
+	return UEProperty(Memory::Read<void*>(Base + Off::OptionalProperty::ValueProperty));
 }
 
 std::string UEOptionalProperty::GetCppType() const
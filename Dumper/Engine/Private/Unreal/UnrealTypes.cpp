@@ -7,6 +7,8 @@
 #include "Encoding/UnicodeNames.h"
 
 #include "Architecture.h"
+#include "OffsetFinder/StaticOffsets.h"
+#include "Profiler/Profiler.h"
 
 
 std::string MakeNameValid(std::wstring&& Name)
@@ -66,8 +68,10 @@ FName::FName(const void* Ptr)
 {
 }
 
-void FName::Init_Windows(bool bForceGNames)
+void* FName::FindAppendStringCall_Windows(const void* StringRef, bool& bOutFoundPotentiallyOverlappingSig)
 {
+	bOutFoundPotentiallyOverlappingSig = false;
+
 #ifdef PLATFORM_WINDOWS
 
 #if defined(_WIN64)
@@ -87,37 +91,74 @@ void FName::Init_Windows(bool bForceGNames)
 	};
 #endif
 
+	void* Result = nullptr;
+	const char* MatchingSig = nullptr;
+
+	for (int i = 0; !Result && i < PossibleSigs.size(); i++)
+	{
+		Result = Platform::FindPatternInRange(PossibleSigs[i], StringRef, 0x50, true, -1/* auto */);
+
+		if (Result)
+			MatchingSig = PossibleSigs[i];
+	}
+
+	// This signature partially overlaps with the signature for an inlined FName::AppendString call (see FindInlinedAppendStringCall_Windows)
+	bOutFoundPotentiallyOverlappingSig = MatchingSig && strcmp(MatchingSig, "48 8D ? ? ? 48 8B ? E8") == 0;
+
+	return Result;
+
+#endif // PLATFORM_WINDOWS
+
+	return nullptr;
+}
+
+void* FName::FindInlinedAppendStringCall_Windows(const void* StringRef)
+{
+	/*
+	* 0x00: 8B ? ?          mov     ecx, [...]
+	* 0x03: E8 ? ? ? ?      call    FName::GetComparisonNameEntry
+	* 0x08: 48 8D ? ?       lea     rdx, [...]
+	* 0x0B: 48 8B C8        mov     rcx, rax
+	* 0x10: E8 ? ? ? ?      call    FNameEntry::GetName
+	*/
+	return Platform::FindPatternInRange("8B ? ? E8 ? ? ? ? 48 8D ? ? ? 48 8B C8 E8 ? ? ? ?", StringRef, 0x180);
+}
+
+void* FName::FindAppendString_Windows()
+{
+#ifdef PLATFORM_WINDOWS
+
 	const void* StringRef = Platform::FindByStringInAllSections("ForwardShadingQuality_", 0x0, 0x0, Settings::General::bSearchOnlyExecutableSectionsForStrings);
-	
+
 	bool bFoundPotentiallyOverlappingSig = false;
+	void* Result = StringRef ? FindAppendStringCall_Windows(StringRef, bFoundPotentiallyOverlappingSig) : nullptr;
 
-	if (StringRef)
-	{
-		const char* MatchingSig = nullptr;
+	/* An inlined AppendString is called through FNameEntry::GetName, which doesn't have the signature of AppendString */
+	if ((!Result || bFoundPotentiallyOverlappingSig) && StringRef && FindInlinedAppendStringCall_Windows(StringRef))
+		return nullptr;
 
-		for (int i = 0; !AppendString && i < PossibleSigs.size(); i++)
-		{
-			AppendString = static_cast<decltype(AppendString)>(Platform::FindPatternInRange(PossibleSigs[i], StringRef, 0x50, true, -1/* auto */));
+	return Result ? Result : TryFindApendStringBackupStringRef_Windows();
 
-			if (AppendString)
-				MatchingSig = PossibleSigs[i];
-		}
+#endif // PLATFORM_WINDOWS
 
-		// This signature partially overlaps with the signature for an inlined FName::AppendString call (see comment below)
-		bFoundPotentiallyOverlappingSig = MatchingSig && strcmp(MatchingSig, "48 8D ? ? ? 48 8B ? E8") == 0;
-	}
+	return nullptr;
+}
+
+void FName::Init_Windows(bool bForceGNames)
+{
+#ifdef PLATFORM_WINDOWS
+
+	const void* StringRef = Platform::FindByStringInAllSections("ForwardShadingQuality_", 0x0, 0x0, Settings::General::bSearchOnlyExecutableSectionsForStrings);
+	
+	bool bFoundPotentiallyOverlappingSig = false;
+
+	if (StringRef)
+		AppendString = static_cast<decltype(AppendString)>(FindAppendStringCall_Windows(StringRef, bFoundPotentiallyOverlappingSig));
 
 	// Test if AppendString was inlined
 	if ((!AppendString || bFoundPotentiallyOverlappingSig) && !bForceGNames && StringRef)
 	{
-		/*
-		* 0x00: 8B ? ?          mov     ecx, [...]
-		* 0x03: E8 ? ? ? ?      call    FName::GetComparisonNameEntry
-		* 0x08: 48 8D ? ?       lea     rdx, [...]
-		* 0x0B: 48 8B C8        mov     rcx, rax
-		* 0x10: E8 ? ? ? ?      call    FNameEntry::GetName
-		*/
-		if (void* SigScanResult = Platform::FindPatternInRange("8B ? ? E8 ? ? ? ? 48 8D ? ? ? 48 8B C8 E8 ? ? ? ?", StringRef, 0x180))
+		if (void* SigScanResult = FindInlinedAppendStringCall_Windows(StringRef))
 		{
 			const uintptr_t ResultAsInt = reinterpret_cast<const uintptr_t>(SigScanResult);
 
@@ -272,17 +313,13 @@ void* FName::TryFindApendStringBackupStringRef_Windows()
 
 	if (StringRef)
 	{
-		const char* MatchingSig = nullptr;
-
 		// AppendString comes before the string ref, so search upwards (in IDA terms)
 		const uintptr_t SigSearchStartAddress = reinterpret_cast<uintptr_t>(StringRef) - 0xB0;
 
-		for (int i = 0; !AppendString && i < PossibleSigs.size(); i++)
+		for (int i = 0; i < PossibleSigs.size(); i++)
 		{
-			AppendString = static_cast<decltype(AppendString)>(Platform::FindPatternInRange(PossibleSigs[i], SigSearchStartAddress, 0x100, true, -1/* auto */));
-
-			if (AppendString)
-				return AppendString;
+			if (void* Result = Platform::FindPatternInRange(PossibleSigs[i], SigSearchStartAddress, 0x100, true, -1/* auto */))
+				return Result;
 		}
 	}
 #endif // PLATFORM_WINDOWS
@@ -294,7 +331,9 @@ void FName::InitFallback()
 {
 	Off::InSDK::Name::bIsUsingAppendStringOverToString = false;
 
-	void* Conv_NameToStringAddress = FindUnrealExecFunctionByString("Conv_NameToString");
+	void* Conv_NameToStringAddress = StaticOffsets::Conv_NameToString != 0x0
+		? reinterpret_cast<void*>(Platform::GetModuleBase() + StaticOffsets::Conv_NameToString)
+		: FindUnrealExecFunctionByString("Conv_NameToString");
 
 	constexpr std::array<const char*, 3> PossibleSigs =
 	{
@@ -320,6 +359,8 @@ std::wstring FName::ToRawWString() const
 	if (!Address)
 		return L"None";
 
+	Profiler::Increment(Profiler::ECounter::NamesResolved);
+
 	return ToStr(Address);
 }
 
@@ -372,6 +413,17 @@ uint32 FName::GetNumber() const
 	return static_cast<uint32_t>(*reinterpret_cast<const int32*>(Address + Off::FName::Number));
 }
 
+int32 FName::GetDisplayIndex() const
+{
+	if (!Settings::Internal::bUseCasePreservingName)
+		return GetCompIdx();
+
+	/* Same layout as the FName generated into the SDK, DisplayIndex directly follows ComparisonIndex and Number */
+	const int32 DisplayIndexOffset = Off::FName::Number == 4 ? 0x8 : 0x4;
+
+	return *reinterpret_cast<const int32*>(Address + DisplayIndexOffset);
+}
+
 bool FName::operator==(FName Other) const
 {
 	return GetCompIdx() == Other.GetCompIdx();
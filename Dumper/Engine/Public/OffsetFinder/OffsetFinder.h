@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "Unreal/ObjectArray.h"
+#include "OffsetFinder/OffsetSolver.h"
 
 #include "Platform.h"
 
@@ -11,11 +12,11 @@ namespace OffsetFinder
 	constexpr int32 OffsetNotFound = -1;
 	constexpr int32 OffsetFinderMinValue = Platform::Is32Bit() ? 0x18 : 0x28;
 
+	/* Offset at which every object has its value, see OffsetSolver */
 	template<int Alignement = 4, typename T>
 	inline int32_t FindOffset(const std::vector<std::pair<void*, T>>& ObjectValuePair, int MinOffset = OffsetFinderMinValue, int MaxOffset = 0x1A0)
 	{
-		int32_t HighestFoundOffset = MinOffset;
-		bool bFoundOffset = false;
+		OffsetSolver<T, Alignement> Solver(MinOffset, MaxOffset);
 
 		for (int i = 0; i < ObjectValuePair.size(); i++)
 		{
@@ -25,26 +26,10 @@ namespace OffsetFinder
 				continue;
 			}
 
-			for (int j = HighestFoundOffset; j < MaxOffset; j += Alignement)
-			{
-				const T TypedValueAtOffset = *reinterpret_cast<T*>(static_cast<uint8_t*>(ObjectValuePair[i].first) + j);
-
-				if (TypedValueAtOffset == ObjectValuePair[i].second && j >= HighestFoundOffset)
-				{
-					bFoundOffset = true;
-
-					if (j > HighestFoundOffset)
-					{
-						HighestFoundOffset = j;
-						i = 0;
-					}
-					j = MaxOffset;
-				}
-			}
+			Solver.AddSample(ObjectValuePair[i].first, ObjectValuePair[i].second);
 		}
 
-		//return HighestFoundOffset != MinOffset ? HighestFoundOffset : OffsetNotFound;
-		return bFoundOffset ? HighestFoundOffset : OffsetNotFound;
+		return Solver.Solve();
 	}
 
 	template<bool bCheckForVft = true>
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <type_traits>
+
+
+/*
+* Finds the offset of a member from sample objects and the value that member has in each of them.
+*
+* The window [MinOffset, MaxOffset) of every sample is copied into one row of a contiguous matrix up front. Every candidate offset is a column,
+* all columns of a row are compared against the sample's value in one tight loop over the row (which the compiler vectorizes), and the matches
+* are counted per column.
+*
+* The first column every sample matches in is the offset. If there is none, the samples are resolved the way the previous per-object search
+* did it, which tolerates samples without any match.
+*
+* Only depends on the standard library, rows can be added from synthetic buffers.
+*/
+template<typename T, int32_t Alignment = 4>
+class OffsetSolver
+{
+	static_assert(std::is_trivially_copyable_v<T>, "OffsetSolver can only compare trivially-copyable types!");
+	static_assert(Alignment > 0, "Alignment must be positive!");
+
+public:
+	static constexpr int32_t OffsetNotFound = -1;
+
+private:
+	int32_t MinOffset;
+	int32_t MaxOffset;
+
+	int32_t NumColumns;
+
+	/* Enough bytes to read a T at the last column */
+	int32_t RowSize;
+
+	std::vector<uint8_t> Rows;
+	std::vector<T> Values;
+
+public:
+	inline OffsetSolver(int32_t InMinOffset, int32_t InMaxOffset)
+		: MinOffset(InMinOffset)
+		, MaxOffset(InMaxOffset > InMinOffset ? InMaxOffset : InMinOffset)
+		, NumColumns((MaxOffset - MinOffset + (Alignment - 1)) / Alignment)
+		, RowSize(NumColumns > 0 ? ((NumColumns - 1) * Alignment) + static_cast<int32_t>(sizeof(T)) : 0)
+	{
+	}
+
+public:
+	/* 'Row' holds the bytes of a sample starting at MinOffset, at least GetRowSize() of them */
+	inline void AddSampleRow(const uint8_t* Row, const T& Value)
+	{
+		Rows.insert(Rows.end(), Row, Row + RowSize);
+		Values.push_back(Value);
+	}
+
+	inline void AddSample(const void* Object, const T& Value)
+	{
+		AddSampleRow(static_cast<const uint8_t*>(Object) + MinOffset, Value);
+	}
+
+	inline int32_t GetRowSize() const { return RowSize; }
+	inline int32_t GetNumColumns() const { return NumColumns; }
+	inline int32_t GetNumSamples() const { return static_cast<int32_t>(Values.size()); }
+
+	inline int32_t ColumnToOffset(int32_t Column) const { return MinOffset + (Column * Alignment); }
+
+public:
+	/* One byte per sample and column, 1 if the sample has its value at that column */
+	inline std::vector<uint8_t> GetMatchMatrix() const
+	{
+		std::vector<uint8_t> Matches(Values.size() * NumColumns);
+
+		for (size_t Sample = 0; Sample < Values.size(); Sample++)
+		{
+			const uint8_t* Row = Rows.data() + (Sample * RowSize);
+			uint8_t* RowMatches = Matches.data() + (Sample * NumColumns);
+
+			const T Value = Values[Sample];
+
+			for (int32_t Column = 0; Column < NumColumns; Column++)
+			{
+				T ValueAtColumn;
+				std::memcpy(&ValueAtColumn, Row + (Column * Alignment), sizeof(T));
+
+				RowMatches[Column] = static_cast<uint8_t>(ValueAtColumn == Value);
+			}
+		}
+
+		return Matches;
+	}
+
+	inline std::vector<int32_t> GetColumnMatchCounts(const std::vector<uint8_t>& Matches) const
+	{
+		std::vector<int32_t> Counts(NumColumns, 0);
+
+		for (size_t Sample = 0; Sample < Values.size(); Sample++)
+		{
+			const uint8_t* RowMatches = Matches.data() + (Sample * NumColumns);
+
+			for (int32_t Column = 0; Column < NumColumns; Column++)
+				Counts[Column] += RowMatches[Column];
+		}
+
+		return Counts;
+	}
+
+	inline int32_t Solve() const
+	{
+		if (Values.empty() || NumColumns == 0)
+			return OffsetNotFound;
+
+		const std::vector<uint8_t> Matches = GetMatchMatrix();
+		const std::vector<int32_t> Counts = GetColumnMatchCounts(Matches);
+
+		const int32_t NumSamples = GetNumSamples();
+
+		for (int32_t Column = 0; Column < NumColumns; Column++)
+		{
+			if (Counts[Column] == NumSamples)
+				return ColumnToOffset(Column);
+		}
+
+		/*
+		* No column matches every sample. Walk the samples like the previous search did: the candidate only moves up, to the first match of a
+		* sample at or after it, samples without such a match are skipped, and every increase re-checks the samples after the first one.
+		*/
+		int32_t Candidate = 0;
+		bool bFoundOffset = false;
+
+		for (int32_t Sample = 0; Sample < NumSamples; Sample++)
+		{
+			const uint8_t* RowMatches = Matches.data() + (Sample * NumColumns);
+
+			for (int32_t Column = Candidate; Column < NumColumns; Column++)
+			{
+				if (!RowMatches[Column])
+					continue;
+
+				bFoundOffset = true;
+
+				if (Column > Candidate)
+				{
+					Candidate = Column;
+					Sample = 0;
+				}
+
+				break;
+			}
+		}
+
+		return bFoundOffset ? ColumnToOffset(Candidate) : OffsetNotFound;
+	}
+};
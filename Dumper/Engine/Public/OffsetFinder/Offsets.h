@@ -42,6 +42,10 @@ namespace Off
 			inline int32 PEOffset;
 
 			void InitPE_Windows();
+
+			/* Start of the function following the reference to L"Accessed None", which is ProcessEvent in some games. Only needs the code, not the objects. */
+			const void* FindPECandidateByString_Windows();
+
 			void InitPE(const int32 Index, const char* const ModuleName = Settings::General::DefaultModuleName);
 		}
 
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+
+#include "Unreal/Enums.h"
+
+
+/*
+* Code-side offsets that only depend on the game's executable. They are found in the file on disk (see PlatformWindows::LoadStaticImage()) while
+* the game isn't running, the dump then only validates them against the loaded module instead of searching for them.
+*
+* GWorld isn't one of them, it's found through the address of a live UWorld object.
+*/
+namespace StaticOffsets
+{
+	/* RVAs in the main module, 0x0 if they weren't found or didn't pass validation */
+	inline int32 AppendString = 0x0;
+	inline int32 ProcessEvent = 0x0;
+	inline int32 Conv_NameToString = 0x0;
+
+	/* Maps the executable at 'ImagePath' in place of the loaded module, searches it and writes the offsets to 'OutputPath'. Nothing can be dumped afterwards. */
+	bool Precompute(const std::string& ImagePath, const std::string& OutputPath);
+
+	/* Reads offsets written by Precompute(), the ones that don't point to the start of a function in the loaded module are dropped. False if they're for another build. */
+	bool LoadAndValidate(const std::string& Path);
+
+	/* Index of 'ProcessEvent' in the vtable of UObject, -1 if it isn't in there. Requires the ObjectArray to be initialized. */
+	int32 FindProcessEventIndex();
+}
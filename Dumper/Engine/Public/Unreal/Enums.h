@@ -365,6 +365,48 @@ enum class EMappingsTypeFlags : uint8
 	Unknown = 0xFF
 };
 
+/* Dense classification of a property-class by its cast-flags, see UEProperty::GetPropertyKind() */
+enum class EPropertyKind : uint8
+{
+	Byte,
+	UInt16,
+	UInt32,
+	UInt64,
+	Int8,
+	Int16,
+	Int,
+	Int64,
+	Float,
+	Double,
+	Class,
+	Name,
+	Str,
+	Text,
+	Bool,
+	Struct,
+	Array,
+	Delegate,
+	WeakObject,
+	LazyObject,
+	SoftClass,
+	SoftObject,
+	Object,
+	ObjectBase, // Only ObjectPropertyBase is set, eg. encrypted object-pointers
+	Map,
+	Set,
+	Enum,
+	Interface,
+	FieldPath,
+	MulticastInlineDelegate,
+	MulticastSparseDelegate,
+	MulticastDelegate,
+	Optional,
+	Utf8Str,
+	AnsiStr,
+
+	Unknown
+};
+
 enum class EUsmapCompressionMethod : uint8
 {
 	None,
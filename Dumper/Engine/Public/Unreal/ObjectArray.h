@@ -29,13 +29,23 @@ public:
 	static inline std::string DecryptionLambdaStr;
 
 private:
-	static inline void*(*ByIndex)(void* ObjectsArray, int32 Index, uint32 FUObjectItemSize, uint32 FUObjectItemOffset, uint32 PerChunk) = nullptr;
+	/* Set by ResolveByIndex() once the layout is known, points to the instantiation of GetObjectPtrByIndex() matching the layout */
+	static inline void*(*ByIndex)(int32 Index) = nullptr;
 
 	static inline uint8_t* (*DecryptPtr)(void* ObjPtr) = [](void* Ptr) -> uint8* { return static_cast<uint8*>(Ptr); };
+	static inline bool bUsesDecryption = false;
 
 private:
 	static void InitializeFUObjectItem(uint8_t* FirstItemPtr);
 
+	template<bool bIsChunked, bool bIsDecrypted>
+	static void* GetObjectPtrByIndex(int32 Index);
+
+	static void ResolveByIndex();
+
+	/* Address of the first item's UObject-pointer in the chunk. A FFixedUObjectArray is treated as one single chunk. */
+	static uint8* GetChunkItems(int32 ChunkIndex);
+
 public:
 	static void InitDecryption(uint8_t* (*DecryptionFunction)(void* ObjPtr), const char* DecryptionLambdaAsStr);
 
@@ -75,6 +85,21 @@ public:
 		UEObject CurrentObject;
 		int32 CurrentIndex;
 
+		/* Read once on construction, objects added while iterating aren't visited */
+		int32 NumObjects;
+
+		/* The chunk containing 'CurrentIndex', so stepping through a chunk is a pointer-add instead of a lookup through GetByIndex() */
+		uint8* CurrentChunkItems = nullptr;
+		int32 ChunkIndex = 0x0;
+		int32 IndexInChunk = 0x0;
+		int32 ElementsPerChunk = 0x0;
+
+	private:
+		inline bool IsEnd() const
+		{
+			return CurrentIndex >= NumObjects;
+		}
+
 	public:
 		ObjectsIterator(int32 StartIndex = 0);
 
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "Unreal/UnrealObjects.h"
+
+
+/*
+* Builds the names UEObject::GetFullName() and UEObject::GetPathName() return, for many objects at once.
+*
+* The dotted path of every outer ("Package.Outer") is stored once in a string-arena, keyed by the outer's object-index. The name of an object is
+* then its class-name, the cached path of its direct outer and its own name appended to each other, siblings no longer re-resolve their outers.
+*
+* Not thread-safe, use one instance per thread.
+*/
+class ObjectPathCache
+{
+private:
+	struct CachedPath
+	{
+		uint64 Offset = 0x0;
+		uint32 Length = 0x0;
+	};
+
+private:
+	/* Names with the full path to the object, like UEObject::GetPathName() */
+	bool bWithPathname;
+
+	std::string Arena;
+
+	/* Keyed by object-index, only outers are ever cached. Sized by the outers actually visited, not by the highest object-index. */
+	std::unordered_map<int32, CachedPath> Paths;
+
+public:
+	explicit ObjectPathCache(bool bUsePathnames = false);
+
+private:
+	std::string GetObjectName(UEObject Object) const;
+
+	const CachedPath& GetOrAddPath(UEObject Object);
+
+public:
+	/* Appends the same string UEObject::GetFullName(), or UEObject::GetPathName() if 'bUsePathnames' was set, would return */
+	void AppendName(std::string& OutName, UEObject Object);
+
+	std::string GetName(UEObject Object);
+};
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <stdexcept>
+#include <bit>
 
 #include "Enums.h"
 #include "Encoding/UtfN.hpp"
@@ -151,6 +152,65 @@ namespace UC
 
 			inline bool IsValid() const { return GetData() && NumBits > 0; }
 
+		public:
+			/* Calls 'Callback(int32 FirstIndex, int32 NumBitsInRun)' for every run of consecutive set bits, in ascending order */
+			template<typename CallbackType>
+			inline void ForEachSetBitRun(CallbackType Callback) const
+			{
+				const uint32* Words = GetData();
+
+				if (!Words || NumBits <= 0)
+					return;
+
+				const int32 NumWords = (NumBits + NumBitsPerDWORD - 1) >> NumBitsPerDWORDLogTwo;
+				const int32 NumBitsInLastWord = NumBits & (NumBitsPerDWORD - 1);
+
+				int32 RunStartIndex = -1;
+
+				for (int32 WordIndex = 0; WordIndex < NumWords; WordIndex++)
+				{
+					uint32 Word = Words[WordIndex];
+
+					/* Bits past NumBits are not part of the array */
+					if (WordIndex == (NumWords - 1) && NumBitsInLastWord != 0)
+						Word &= (1U << NumBitsInLastWord) - 1;
+
+					/* The whole word either continues the current run, or contains no set bit at all */
+					if (Word == (RunStartIndex != -1 ? ~0U : 0U))
+						continue;
+
+					const int32 WordBaseIndex = WordIndex << NumBitsPerDWORDLogTwo;
+
+					for (int32 BitOffset = 0; BitOffset < NumBitsPerDWORD;)
+					{
+						const uint32 RemainingBits = Word >> BitOffset;
+
+						if (RunStartIndex == -1)
+						{
+							if (!RemainingBits)
+								break;
+
+							BitOffset += std::countr_zero(RemainingBits);
+							RunStartIndex = WordBaseIndex + BitOffset;
+						}
+						else
+						{
+							BitOffset += std::countr_one(RemainingBits);
+
+							/* The run continues into the next word */
+							if (BitOffset >= NumBitsPerDWORD)
+								break;
+
+							Callback(RunStartIndex, (WordBaseIndex + BitOffset) - RunStartIndex);
+							RunStartIndex = -1;
+						}
+					}
+				}
+
+				if (RunStartIndex != -1)
+					Callback(RunStartIndex, NumBits - RunStartIndex);
+			}
+
 		public:
 			inline bool operator[](int32 Index) const { VerifyIndex(Index); return GetData()[Index / NumBitsPerDWORD] & (1 << (Index & (NumBitsPerDWORD - 1))); }
 
@@ -588,6 +648,23 @@ namespace UC
 	public:
 		const ContainerImpl::FBitArray& GetAllocationFlags() const { return AllocationFlags; }
 
+	public:
+		/* Calls 'Callback(int32 FirstIndex, int32 NumElements)' for every run of consecutive allocated elements */
+		template<typename CallbackType>
+		inline void ForEachAllocated(CallbackType Callback) const
+		{
+			const int32 NumIndices = NumAllocated();
+
+			AllocationFlags.ForEachSetBitRun([&](int32 FirstIndex, int32 NumInRun) -> void
+			{
+				/* The allocation-flags may have more bits than there are elements */
+				if (FirstIndex >= NumIndices)
+					return;
+
+				Callback(FirstIndex, FirstIndex + NumInRun > NumIndices ? NumIndices - FirstIndex : NumInRun);
+			});
+		}
+
 	public:
 		inline       SparseArrayElementType& operator[](int32 Index)       { VerifyIndex(Index); return *reinterpret_cast<      SparseArrayElementType*>(&Data.GetUnsafe(Index).ElementData); }
 		inline const SparseArrayElementType& operator[](int32 Index) const { VerifyIndex(Index); return *reinterpret_cast<const SparseArrayElementType*>(&Data.GetUnsafe(Index).ElementData); }
@@ -645,6 +722,11 @@ namespace UC
 	public:
 		const ContainerImpl::FBitArray& GetAllocationFlags() const { return Elements.GetAllocationFlags(); }
 
+	public:
+		/* Calls 'Callback(int32 FirstIndex, int32 NumElements)' for every run of consecutive allocated elements */
+		template<typename CallbackType>
+		inline void ForEachAllocated(CallbackType Callback) const { Elements.ForEachAllocated(Callback); }
+
 	public:
 		inline       SetElementType& operator[] (int32 Index)       { return Elements[Index].Value; }
 		inline const SetElementType& operator[] (int32 Index) const { return Elements[Index].Value; }
@@ -682,6 +764,11 @@ namespace UC
 	public:
 		const ContainerImpl::FBitArray& GetAllocationFlags() const { return Elements.GetAllocationFlags(); }
 
+	public:
+		/* Calls 'Callback(int32 FirstIndex, int32 NumElements)' for every run of consecutive allocated elements */
+		template<typename CallbackType>
+		inline void ForEachAllocated(CallbackType Callback) const { Elements.ForEachAllocated(Callback); }
+
 	public:
 		inline decltype(auto) Find(const KeyElementType& Key, bool(*Equals)(const KeyElementType& Key, const ValueElementType& Value))
 		{
@@ -708,48 +795,42 @@ namespace UC
 
 	namespace Iterators
 	{
-		class FRelativeBitReference
+		class FSetBitIterator
 		{
-		protected:
+		private:
 			static constexpr int32 NumBitsPerDWORD = 32;
 			static constexpr int32 NumBitsPerDWORDLogTwo = 5;
 
-		public:
-			inline explicit FRelativeBitReference(int32 BitIndex)
-				: WordIndex(BitIndex >> NumBitsPerDWORDLogTwo)
-				, Mask(1 << (BitIndex & (NumBitsPerDWORD - 1)))
-			{
-			}
-
-			int32  WordIndex;
-			uint32 Mask;
-		};
-
-		class FSetBitIterator : public FRelativeBitReference
-		{
 		private:
 			const ContainerImpl::FBitArray& Array;
 
-			uint32 UnvisitedBitMask;
+			/* Bits of the current word that were not visited yet */
+			uint32 UnvisitedBits;
+			int32 WordIndex;
 			int32 CurrentBitIndex;
-			int32 BaseBitIndex;
 
 		public:
 			explicit FSetBitIterator(const ContainerImpl::FBitArray& InArray, int32 StartIndex = 0)
-				: FRelativeBitReference(StartIndex)
-				, Array(InArray)
-				, UnvisitedBitMask((~0U) << (StartIndex & (NumBitsPerDWORD - 1)))
+				: Array(InArray)
+				, UnvisitedBits(0)
+				, WordIndex(StartIndex >> NumBitsPerDWORDLogTwo)
 				, CurrentBitIndex(StartIndex)
-				, BaseBitIndex(StartIndex & ~(NumBitsPerDWORD - 1))
 			{
-				if (StartIndex != Array.Num())
-					FindFirstSetBit();
+				if (StartIndex >= Array.Num())
+				{
+					CurrentBitIndex = Array.Num();
+					return;
+				}
+
+				UnvisitedBits = Array.GetData()[WordIndex] & ((~0U) << (StartIndex & (NumBitsPerDWORD - 1)));
+				FindFirstSetBit();
 			}
 
 		public:
 			inline FSetBitIterator& operator++()
 			{
-				UnvisitedBitMask &= ~this->Mask;
+				/* Clear the lowest set bit, which is the one we're currently at */
+				UnvisitedBits &= UnvisitedBits - 1;
 
 				FindFirstSetBit();
 
@@ -768,28 +849,21 @@ namespace UC
 			{
 				const uint32* ArrayData = Array.GetData();
 				const int32   ArrayNum = Array.Num();
-				const int32   LastWordIndex = (ArrayNum - 1) / NumBitsPerDWORD;
+				const int32   NumWords = (ArrayNum + NumBitsPerDWORD - 1) >> NumBitsPerDWORDLogTwo;
 
-				uint32 RemainingBitMask = ArrayData[this->WordIndex] & UnvisitedBitMask;
-				while (!RemainingBitMask)
+				/* Skip whole words without any allocated element */
+				while (!UnvisitedBits)
 				{
-					++this->WordIndex;
-					BaseBitIndex += NumBitsPerDWORD;
-					if (this->WordIndex > LastWordIndex)
+					if (++WordIndex >= NumWords)
 					{
 						CurrentBitIndex = ArrayNum;
 						return;
 					}
 
-					RemainingBitMask = ArrayData[this->WordIndex];
-					UnvisitedBitMask = ~0;
+					UnvisitedBits = ArrayData[WordIndex];
 				}
 
-				const uint32 NewRemainingBitMask = RemainingBitMask & (RemainingBitMask - 1);
-
-				this->Mask = NewRemainingBitMask ^ RemainingBitMask;
-
-				CurrentBitIndex = BaseBitIndex + NumBitsPerDWORD - 1 - ContainerImpl::HelperFunctions::CountLeadingZeros(this->Mask);
+				CurrentBitIndex = (WordIndex << NumBitsPerDWORDLogTwo) + std::countr_zero(UnvisitedBits);
 
 				if (CurrentBitIndex > ArrayNum)
 					CurrentBitIndex = ArrayNum;
@@ -262,6 +262,9 @@ public:
 	std::pair<UEClass, UEFFieldClass> GetClass() const;
 	EClassCastFlags GetCastFlags() const;
 
+	/* Classifies the property-class once per thread, switch over the result instead of testing the cast-flags one after another */
+	EPropertyKind GetPropertyKind() const;
+
 	explicit operator bool() const;
 
 	bool IsA(EClassCastFlags TypeFlags) const;
@@ -102,7 +102,12 @@ public:
 
 	static void Init(int32 OverrideOffset, EOffsetOverrideType OverrideType = EOffsetOverrideType::AppendString, bool bIsNamePool = false, const char* const ModuleName = Settings::General::DefaultModuleName);
 
+	/* Searches FName::AppendString the same way Init_Windows() does, without initializing anything. nullptr if it was inlined or wasn't found. */
+	static void* FindAppendString_Windows();
+
 private:
+	static void* FindAppendStringCall_Windows(const void* StringRef, bool& bOutFoundPotentiallyOverlappingSig);
+	static void* FindInlinedAppendStringCall_Windows(const void* StringRef);
 	static void* TryFindApendStringBackupStringRef_Windows();
 
 public:
@@ -117,6 +122,7 @@ public:
 
 	int32 GetCompIdx() const;
 	uint32 GetNumber() const;
+	int32 GetDisplayIndex() const;
 
 	bool operator==(FName Other) const;
 
@@ -1,5 +1,6 @@
 #include <vector>
 #include <array>
+#include <unordered_set>
 
 #include "Unreal/ObjectArray.h"
 #include "Generators/CppGenerator.h"
@@ -422,6 +423,15 @@ std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, co
 	std::string FixedOuterName = PrefixQuotsWithBackslash(UnrealFunc.GetOuter().GetName());
 	std::string FixedFunctionName = PrefixQuotsWithBackslash(UnrealFunc.GetName());
 
+	const std::string ClassString = Func.IsStatic() ? "StaticClass()" : Func.IsInInterface() ? "AsUObject()->Class" : "Class";
+	const std::string OuterNameString = CppSettings::XORString ? std::format("{}(\"{}\")", CppSettings::XORString, FixedOuterName) : std::format("\"{}\"", FixedOuterName);
+	const std::string FunctionNameString = CppSettings::XORString ? std::format("{}(\"{}\")", CppSettings::XORString, FixedFunctionName) : std::format("\"{}\"", FixedFunctionName);
+
+	/* With batched function calls all UFunctions of this class are resolved by the class' function-table on the first call */
+	const std::string FunctionLookupString = CppSettings::bGenerateBatchedFunctionCalls
+		? std::format("{}.Get({}, {}, {})", GetFunctionTableName(StructName), ClassString, OuterNameString, FunctionNameString)
+		: std::format("{}->GetFunction({}, {})", ClassString, OuterNameString, FunctionNameString);
+
 	// Function implementation generation
 	std::string FunctionImplementation = std::format(R"(
 // {}
@@ -432,7 +442,7 @@ std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, co
 	static class UFunction* Func = nullptr;
 
 	if (Func == nullptr)
-		Func = {}->GetFunction({}, {});
+		Func = {};
 {}{}{}
 	{}ProcessEvent(Func, {});{}{}{}{}
 }}
@@ -444,9 +454,7 @@ std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, co
 , StructName
 , FuncInfo.FuncNameWithParams
 , bIsConstFunc ? " const" : ""
-, Func.IsStatic() ? "StaticClass()" : Func.IsInInterface() ? "AsUObject()->Class" : "Class"
-, CppSettings::XORString ? std::format("{}(\"{}\")", CppSettings::XORString, FixedOuterName) : std::format("\"{}\"", FixedOuterName)
-, CppSettings::XORString ? std::format("{}(\"{}\")", CppSettings::XORString, FixedFunctionName) : std::format("\"{}\"", FixedFunctionName)
+, FunctionLookupString
 , bHasParams ? ParamVarCreationString : ""
 , bHasParamsToInit ? ParamAssignments : ""
 , bIsNativeFunc ? StoreFunctionFlagsString : ""
@@ -544,12 +552,21 @@ std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const M
 
 	const bool bIsInterface = Struct.IsInterface();
 
+	bool bHasWrittenFunctionTable = false;
+
 	for (const FunctionWrapper& Func : Members.IterateFunctions())
 	{
 		/* The function is no callable function, but instead just the signature of a TDelegate or TMulticastInlineDelegate */
 		if (Func.GetFunctionFlags() & EFunctionFlags::Delegate)
 			continue;
 
+		/* One function-table per class, declared right before the first unreal-function that uses it */
+		if (CppSettings::bGenerateBatchedFunctionCalls && !Func.IsPredefined() && !bHasWrittenFunctionTable)
+		{
+			FunctionFile << std::format("\n// Resolves all UFunctions of {} in a single pass, on the first call to any of them\nstatic FFunctionTable {};\n\n", StructName, GetFunctionTableName(StructName));
+			bHasWrittenFunctionTable = true;
+		}
+
 		// Handeling spacing between static and non-static, const and non-const, as well as inline and non-inline functions
 		if (bWasLastFuncInline != Func.HasInlineBody() && !bIsFirstIteration)
 		{
@@ -595,12 +612,22 @@ std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const M
 	std::string Name = bIsNameUnique ? Struct.GetRawName() : Struct.GetFullName();
 	std::string NameText = CppSettings::XORString ? std::format("{}(\"{}\")", CppSettings::XORString, Name) : std::format("\"{}\"", Name);
 
+	/* Empty if the class' name isn't part of NameTable.hpp */
+	const std::string NameTableClassEntry = GetNameTableClassEntry(Struct);
+
 	if (bIsBPStaticClass)
 	{
 		StaticClass.Body = std::format(
 			R"({{
 	BP_STATIC_CLASS_IMPL{}({})
 }})", (bIsNameUnique ? "" : "_FULLNAME"), NameText);
+	}
+	else if (bIsNameUnique && !NameTableClassEntry.empty())
+	{
+		StaticClass.Body = std::format(
+R"({{
+	STATIC_CLASS_TABLE_IMPL({}, {})
+}})", NameTableClassEntry, NameText);
 	}
 	else
 	{
@@ -613,10 +640,20 @@ R"({{
 	/* ClassName always uses the short name, and it's a wide string for FString */
 	NameText = CppSettings::XORString ? std::format("{}(L\"{}\")", CppSettings::XORString, Struct.GetRawName()) : std::format("L\"{}\"", Struct.GetRawName());
 
-	StaticName.Body = std::format(
+	if (!NameTableClassEntry.empty())
+	{
+		StaticName.Body = std::format(
+R"({{
+	STATIC_NAME_TABLE_IMPL({}, {})
+}})", NameTableClassEntry, NameText);
+	}
+	else
+	{
+		StaticName.Body = std::format(
 R"({{
 	STATIC_NAME_IMPL({})
 }})", NameText);
+	}
 
 	/* Set class-specific parts of 'GetDefaultObj' */
 	GetDefaultObj.ReturnType = std::format("class {}*", StructName);
@@ -720,6 +757,14 @@ void CppGenerator::GenerateStruct(const StructWrapper& Struct, StreamType& Struc
 			StructFile << "\npublic:\n";
 	}
 
+	/* Known at dump-time, so batched calls don't need to look at the flags of the UFunction at runtime */
+	if (Settings::CppGenerator::bGenerateBatchedFunctionCalls && Struct.IsFunction() && Struct.IsUnrealStruct())
+	{
+		const bool bIsNativeFunc = Struct.GetUnrealStruct().Cast<UEFunction>().HasFlags(EFunctionFlags::Native);
+
+		StructFile << std::format("{}\tstatic constexpr bool bIsNativeFunction = {};\n", bHasMembers ? "\n" : "public:\n", bIsNativeFunc);
+	}
+
 	if (bHasFunctions)
 	{
 		StreamType& FuncParamsAssertionFile = Settings::Debug::bGenerateAssertionFile ? AssertionFile : ParamFile;
@@ -854,6 +899,56 @@ std::string CppGenerator::GetEnumUnderlayingType(const EnumWrapper& Enum)
 	return Enum.GetUnderlyingTypeSize() <= 0x8 ? UnderlayingTypesBySize[static_cast<size_t>(Enum.GetUnderlyingTypeSize()) - 1] : "uint8";
 }
 
+std::string CppGenerator::GetFunctionTableName(const std::string& StructName)
+{
+	std::string TableName = StructName;
+	std::replace(TableName.begin(), TableName.end(), ':', '_');
+
+	return TableName + "_FunctionTable";
+}
+
+std::string CppGenerator::GetNameTableIdentifier(const FName Name)
+{
+	/* C++ keywords, and the types and macros visible where the NameTable is declared and included */
+	static const std::unordered_set<std::string> ReservedIdentifiers =
+	{
+		"alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break", "case", "catch", "char", "char8_t", "char16_t",
+		"char32_t", "class", "compl", "concept", "const", "consteval", "constexpr", "constinit", "const_cast", "continue", "co_await", "co_return",
+		"co_yield", "decltype", "default", "delete", "do", "double", "dynamic_cast", "else", "enum", "explicit", "export", "extern", "false", "float",
+		"for", "friend", "goto", "if", "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq", "nullptr", "operator",
+		"or", "or_eq", "private", "protected", "public", "register", "reinterpret_cast", "requires", "return", "short", "signed", "sizeof", "static",
+		"static_assert", "static_cast", "struct", "switch", "template", "this", "thread_local", "throw", "true", "try", "typedef", "typeid",
+		"typename", "union", "unsigned", "using", "virtual", "void", "volatile", "wchar_t", "while", "xor", "xor_eq",
+
+		"byte", "int8", "int16", "int32", "int64", "uint8", "uint16", "uint32", "uint64", "NULL", "TRUE", "FALSE", "IN", "OUT", "CONST", "TEXT",
+		"min", "max", "SDK", "UC", "FName", "FString", "NameTable", "Classes", "Functions", "Properties", "IsValid",
+	};
+
+	std::string Identifier = Name.ToValidString();
+
+	if (ReservedIdentifiers.contains(Identifier))
+		Identifier += '_';
+
+	return Identifier;
+}
+
+std::string CppGenerator::GetNameTableClassEntry(const StructWrapper& Struct)
+{
+	if (!Settings::CppGenerator::bGenerateNameTable || !Struct.IsUnrealStruct())
+		return "";
+
+	const FName Name = Struct.GetUnrealStruct().GetFName();
+	const std::string ValidName = GetNameTableIdentifier(Name);
+
+	auto It = ClassNameTable.find(ValidName);
+
+	/* The valid name might have been taken by a different name, which was made valid to the same string */
+	if (It == ClassNameTable.end() || It->second != NameTableEntry{ Name.GetCompIdx(), Name.GetNumber(), Name.GetDisplayIndex() })
+		return "";
+
+	return "NameTable::Classes::" + ValidName;
+}
+
 std::string CppGenerator::GetAssertionMacroString(const std::string& PrefixedStructUniqueName)
 {
 	std::string MacroStructName = PrefixedStructUniqueName;
@@ -926,77 +1021,45 @@ std::string CppGenerator::GetMemberTypeString(UEProperty Member, int32 PackageIn
 
 std::string CppGenerator::GetMemberTypeStringWithoutConst(UEProperty Member, int32 PackageIndex, bool* bOutIsUnknownProperty)
 {
-	auto [Class, FieldClass] = Member.GetClass();
-
-	EClassCastFlags Flags = Class ? Class.GetCastFlags() : FieldClass.GetCastFlags();
-
-	if (Flags & EClassCastFlags::ByteProperty)
+	switch (Member.GetPropertyKind())
 	{
+	case EPropertyKind::Byte:
 		if (UEEnum Enum = Member.Cast<UEByteProperty>().GetEnum())
 			return GetEnumPrefixedName(Enum);
 
 		return "uint8";
-	}
-	else if (Flags & EClassCastFlags::UInt16Property)
-	{
+	case EPropertyKind::UInt16:
 		return "uint16";
-	}
-	else if (Flags & EClassCastFlags::UInt32Property)
-	{
+	case EPropertyKind::UInt32:
 		return "uint32";
-	}
-	else if (Flags & EClassCastFlags::UInt64Property)
-	{
+	case EPropertyKind::UInt64:
 		return "uint64";
-	}
-	else if (Flags & EClassCastFlags::Int8Property)
-	{
+	case EPropertyKind::Int8:
 		return "int8";
-	}
-	else if (Flags & EClassCastFlags::Int16Property)
-	{
+	case EPropertyKind::Int16:
 		return "int16";
-	}
-	else if (Flags & EClassCastFlags::IntProperty)
-	{
+	case EPropertyKind::Int:
 		return "int32";
-	}
-	else if (Flags & EClassCastFlags::Int64Property)
-	{
+	case EPropertyKind::Int64:
 		return "int64";
-	}
-	else if (Flags & EClassCastFlags::FloatProperty)
-	{
+	case EPropertyKind::Float:
 		return "float";
-	}
-	else if (Flags & EClassCastFlags::DoubleProperty)
-	{
+	case EPropertyKind::Double:
 		return "double";
-	}
-	else if (Flags & EClassCastFlags::ClassProperty)
-	{
+	case EPropertyKind::Class:
 		if (Member.HasPropertyFlags(EPropertyFlags::UObjectWrapper))
 			return std::format("TSubclassOf<class {}>", GetStructPrefixedName(Member.Cast<UEClassProperty>().GetMetaClass()));
 
 		return "class UClass*";
-	}
-	else if (Flags & EClassCastFlags::NameProperty)
-	{
+	case EPropertyKind::Name:
 		return "class FName";
-	}
-	else if (Flags & EClassCastFlags::StrProperty)
-	{
+	case EPropertyKind::Str:
 		return "class FString";
-	}
-	else if (Flags & EClassCastFlags::TextProperty)
-	{
+	case EPropertyKind::Text:
 		return "class FText";
-	}
-	else if (Flags & EClassCastFlags::BoolProperty)
-	{
+	case EPropertyKind::Bool:
 		return Member.Cast<UEBoolProperty>().IsNativeBool() ? "bool" : GetTypeFromSize(Member.GetSize());
-	}
-	else if (Flags & EClassCastFlags::StructProperty)
+	case EPropertyKind::Struct:
 	{
 		const StructWrapper& UnderlayingStruct = Member.Cast<UEStructProperty>().GetUnderlayingStruct();
 
@@ -1005,92 +1068,70 @@ std::string CppGenerator::GetMemberTypeStringWithoutConst(UEProperty Member, int
 
 		return std::format("struct {}", GetStructPrefixedName(UnderlayingStruct));
 	}
-	else if (Flags & EClassCastFlags::ArrayProperty)
-	{
+	case EPropertyKind::Array:
 		return std::format("TArray<{}>", GetMemberTypeStringWithoutConst(Member.Cast<UEArrayProperty>().GetInnerProperty(), PackageIndex));
-	}
-	else if (Flags & EClassCastFlags::WeakObjectProperty)
-	{
+	case EPropertyKind::WeakObject:
 		if (UEClass PropertyClass = Member.Cast<UEWeakObjectProperty>().GetPropertyClass())
 			return std::format("TWeakObjectPtr<class {}>", GetStructPrefixedName(PropertyClass));
 
 		return "TWeakObjectPtr<class UObject>";
-	}
-	else if (Flags & EClassCastFlags::LazyObjectProperty)
-	{
+	case EPropertyKind::LazyObject:
 		if (UEClass PropertyClass = Member.Cast<UELazyObjectProperty>().GetPropertyClass())
 			return std::format("TLazyObjectPtr<class {}>", GetStructPrefixedName(PropertyClass));
 
 		return "TLazyObjectPtr<class UObject>";
-	}
-	else if (Flags & EClassCastFlags::SoftClassProperty)
-	{
+	case EPropertyKind::SoftClass:
 		if (UEClass PropertyClass = Member.Cast<UESoftClassProperty>().GetPropertyClass())
 			return std::format("TSoftClassPtr<class {}>", GetStructPrefixedName(PropertyClass));
 
 		return "TSoftClassPtr<class UObject>";
-	}
-	else if (Flags & EClassCastFlags::SoftObjectProperty)
-	{
+	case EPropertyKind::SoftObject:
 		if (UEClass PropertyClass = Member.Cast<UESoftObjectProperty>().GetPropertyClass())
 			return std::format("TSoftObjectPtr<class {}>", GetStructPrefixedName(PropertyClass));
 
 		return "TSoftObjectPtr<class UObject>";
-	}
-	else if (Flags & EClassCastFlags::ObjectProperty)
-	{
+	case EPropertyKind::Object:
 		if (UEClass PropertyClass = Member.Cast<UEObjectProperty>().GetPropertyClass())
 			return std::format("class {}*", GetStructPrefixedName(PropertyClass));
 
 		return "class UObject*";
-	}
-	else if (Settings::EngineCore::bEnableEncryptedObjectPropertySupport && Flags & EClassCastFlags::ObjectPropertyBase)
-	{
+	case EPropertyKind::ObjectBase:
+		if (!Settings::EngineCore::bEnableEncryptedObjectPropertySupport)
+			break;
+
 		if (UEClass PropertyClass = Member.Cast<UEObjectProperty>().GetPropertyClass())
 			return std::format("TEncryptedObjPtr<class {}>", GetStructPrefixedName(PropertyClass));
 
 		return "TEncryptedObjPtr<class UObject>";
-	}
-	else if (Flags & EClassCastFlags::MapProperty)
+	case EPropertyKind::Map:
 	{
 		UEMapProperty MemberAsMapProperty = Member.Cast<UEMapProperty>();
 
 		return std::format("TMap<{}, {}>", GetMemberTypeStringWithoutConst(MemberAsMapProperty.GetKeyProperty(), PackageIndex), GetMemberTypeStringWithoutConst(MemberAsMapProperty.GetValueProperty(), PackageIndex));
 	}
-	else if (Flags & EClassCastFlags::SetProperty)
-	{
+	case EPropertyKind::Set:
 		return std::format("TSet<{}>", GetMemberTypeStringWithoutConst(Member.Cast<UESetProperty>().GetElementProperty(), PackageIndex));
-	}
-	else if (Flags & EClassCastFlags::EnumProperty)
-	{
+	case EPropertyKind::Enum:
 		if (UEEnum Enum = Member.Cast<UEEnumProperty>().GetEnum())
 			return GetEnumPrefixedName(Enum);
 
 		return GetMemberTypeStringWithoutConst(Member.Cast<UEEnumProperty>().GetUnderlayingProperty(), PackageIndex);
-	}
-	else if (Flags & EClassCastFlags::InterfaceProperty)
-	{
+	case EPropertyKind::Interface:
 		if (UEClass PropertyClass = Member.Cast<UEInterfaceProperty>().GetPropertyClass())
 			return std::format("TScriptInterface<class {}>", GetStructPrefixedName(PropertyClass));
 
 		return "TScriptInterface<class IInterface>";
-	}
-	else if (Flags & EClassCastFlags::DelegateProperty)
-	{
+	case EPropertyKind::Delegate:
 		if (UEFunction SignatureFunc = Member.Cast<UEDelegateProperty>().GetSignatureFunction()) [[likely]]
 			return std::format("TDelegate<{}>", GetFunctionSignature(SignatureFunc));
 
 		return "TDelegate<void()>";
-	}
-	else if (Flags & EClassCastFlags::MulticastInlineDelegateProperty)
-	{
+	case EPropertyKind::MulticastInlineDelegate:
 		if (UEFunction SignatureFunc = Member.Cast<UEMulticastInlineDelegateProperty>().GetSignatureFunction()) [[likely]]
 			return std::format("TMulticastInlineDelegate<{}>", GetFunctionSignature(SignatureFunc));
 
 		return "TMulticastInlineDelegate<void()>";
-	}
-	else if (Flags & EClassCastFlags::FieldPathProperty)
-	{
+	case EPropertyKind::FieldPath:
 		if (Settings::Internal::bIsObjPtrInsteadOfFieldPathProperty)
 		{
 			if (UEClass PropertyClass = Member.Cast<UEObjectProperty>().GetPropertyClass())
@@ -1100,8 +1141,7 @@ std::string CppGenerator::GetMemberTypeStringWithoutConst(UEProperty Member, int
 		}
 
 		return std::format("TFieldPath<class {}>", Member.Cast<UEFieldPathProperty>().GetFieldClass().GetCppName());
-	}
-	else if (Flags & EClassCastFlags::OptionalProperty)
+	case EPropertyKind::Optional:
 	{
 		UEProperty ValueProperty = Member.Cast<UEOptionalProperty>().GetValueProperty();
 
@@ -1111,22 +1151,21 @@ std::string CppGenerator::GetMemberTypeStringWithoutConst(UEProperty Member, int
 
 		return std::format("TOptional<{}, true>", GetMemberTypeStringWithoutConst(ValueProperty, PackageIndex));
 	}
-	else if (Flags & EClassCastFlags::Utf8StrProperty)
-	{
+	case EPropertyKind::Utf8Str:
 		return "FUtf8String";
-	}
-	else if (Flags & EClassCastFlags::AnsiStrProperty)
-	{
+	case EPropertyKind::AnsiStr:
 		return "FUtf8String";
+	default:
+		break;
 	}
-	else
-	{
-		if (bOutIsUnknownProperty)
-			*bOutIsUnknownProperty = true;
 
-		/* When changing this also change 'GetUnknownProperties()' */
-		return (Class ? Class.GetCppName() : FieldClass.GetCppName()) + "_";
-	}
+	if (bOutIsUnknownProperty)
+		*bOutIsUnknownProperty = true;
+
+	auto [Class, FieldClass] = Member.GetClass();
+
+	/* When changing this also change 'GetUnknownProperties()' */
+	return (Class ? Class.GetCppName() : FieldClass.GetCppName()) + "_";
 }
 
 std::string CppGenerator::GetFunctionSignature(UEFunction Func)
@@ -1399,14 +1438,145 @@ void CppGenerator::GenerateDebugAssertions(StreamType& AssertionStream)
 	WriteFileEnd(AssertionStream, EFileType::DebugAssertions);
 }
 
+void CppGenerator::GenerateNameTable(StreamType& NameTableFile)
+{
+	namespace CppSettings = Settings::CppGenerator;
+
+	WriteFileHead(NameTableFile, nullptr, EFileType::NameTable, "Compile-time FNames of classes, functions and properties. Only valid for the exact build of the game the SDK was generated for!");
+
+	/* Number of entries compared to the live name-pool by 'NameTable::IsValid()' */
+	constexpr int32 NumValidationSamples = 0x10;
+
+	using NameTableType = std::unordered_map<std::string, NameTableEntry>;
+
+	NameTableType FunctionNameTable;
+	NameTableType PropertyNameTable;
+
+	std::string ClassDeclarations;
+	std::string FunctionDeclarations;
+	std::string PropertyDeclarations;
+
+	/* Qualified name of the entry, and the FName it was created from */
+	std::vector<std::pair<std::string, FName>> Entries;
+
+	auto AddName = [&Entries](NameTableType& Table, std::string& OutDeclarations, const char* Category, const FName Name) -> void
+	{
+		const NameTableEntry Entry = { Name.GetCompIdx(), Name.GetNumber(), Name.GetDisplayIndex() };
+
+		const auto [It, bWasInserted] = Table.emplace(GetNameTableIdentifier(Name), Entry);
+
+		/* Same name, or a different name which resulted in the same identifier */
+		if (!bWasInserted)
+			return;
+
+		std::string ConstructorParams = std::format("0x{:08X}", Entry.ComparisonIndex);
+
+		if (!Settings::Internal::bUseOutlineNumberName)
+			ConstructorParams += std::format(", 0x{:X}", Entry.Number);
+
+		if (Settings::Internal::bUseCasePreservingName)
+			ConstructorParams += std::format(", 0x{:08X}", Entry.DisplayIndex);
+
+		OutDeclarations += std::format("\tinline constexpr FName {:{}} = FName({});\n", It->first, 50, ConstructorParams);
+
+		Entries.emplace_back(std::format("{}::{}", Category, It->first), Name);
+	};
+
+	ClassNameTable.clear();
+
+	for (UEObject Obj : ObjectArray())
+	{
+		if (!Obj.IsA(EClassCastFlags::Struct))
+			continue;
+
+		if (Obj.IsA(EClassCastFlags::Class))
+		{
+			AddName(ClassNameTable, ClassDeclarations, "Classes", Obj.GetFName());
+		}
+		else if (Obj.IsA(EClassCastFlags::Function))
+		{
+			AddName(FunctionNameTable, FunctionDeclarations, "Functions", Obj.GetFName());
+		}
+
+		for (UEProperty Property : Obj.Cast<UEStruct>().GetProperties())
+			AddName(PropertyNameTable, PropertyDeclarations, "Properties", Property.GetFName());
+	}
+
+	static auto EscapeString = [](std::string&& Str) -> std::string
+	{
+		for (int i = 0; i < Str.size(); i++)
+		{
+			if (Str[i] == '"' || Str[i] == '\\')
+			{
+				Str.insert(i, "\\");
+				i++;
+			}
+		}
+
+		return Str;
+	};
+
+	/* Samples are spread evenly over the table, so shifted indices are detected regardless of where they start */
+	std::string ValidationChecks;
+
+	const size_t SampleStep = std::max<size_t>(Entries.size() / NumValidationSamples, 1);
+
+	for (size_t i = 0; i < Entries.size() && (i / SampleStep) < NumValidationSamples; i += SampleStep)
+	{
+		const auto& [QualifiedName, Name] = Entries[i];
+
+		const std::string RawString = EscapeString(Name.ToRawString());
+		const std::string ExpectedString = CppSettings::XORString ? std::format("{}(\"{}\")", CppSettings::XORString, RawString) : std::format("\"{}\"", RawString);
+
+		ValidationChecks += std::format(R"(
+			if ({}.GetRawString() != {})
+				return false;
+)", QualifiedName, ExpectedString);
+	}
+
+	NameTableFile << std::format(R"(
+namespace NameTable
+{{
+namespace Classes
+{{
+{}}}
+
+namespace Functions
+{{
+{}}}
+
+namespace Properties
+{{
+{}}}
+
+/*
+* Compares a sample of the table against the live name-pool, once.
+* 
+* If the indices shifted (eg. after a game update) StaticClass() and StaticName() fall back to looking names up at runtime.
+*/
+inline bool IsValid()
+{{
+	static const bool bIsValid = []() -> bool
+		{{{}
+			return true;
+		}}();
+
+	return bIsValid;
+}}
+}}
+)", ClassDeclarations, FunctionDeclarations, PropertyDeclarations, ValidationChecks);
+
+	WriteFileEnd(NameTableFile, EFileType::NameTable);
+}
+
 void CppGenerator::GenerateSDKHeader(StreamType& SdkHpp)
 {
 	WriteFileHead(SdkHpp, nullptr, EFileType::SdkHpp, "Includes the entire SDK. Include files directly for faster compilation!");
 
 
-	auto ForEachElementCallback = [&SdkHpp](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void
+	auto ForEachElementCallback = [&SdkHpp](int32 PackageIndex, bool bIsStruct) -> void
 	{
-		PackageInfoHandle CurrentPackage = PackageManager::GetInfo(NewParams.RequiredPackage);
+		PackageInfoHandle CurrentPackage = PackageManager::GetInfo(PackageIndex);
 
 		const bool bHasClassesFile = CurrentPackage.HasClasses();
 		const bool bHasStructsFile = (CurrentPackage.HasStructs() || CurrentPackage.HasEnums());
@@ -1453,6 +1623,9 @@ void CppGenerator::WriteFileHead(StreamType& File, PackageInfoHandle Package, EF
 	if (Type != EFileType::BasicHpp && Type != EFileType::NameCollisionsInl && Type != EFileType::PropertyFixup && Type != EFileType::SdkHpp && Type != EFileType::DebugAssertions && Type != EFileType::UnrealContainers && Type != EFileType::UnicodeLib)
 		File << "#include \"Basic.hpp\"\n";
 
+	if (Type == EFileType::Classes && CppSettings::bGenerateNameTable)
+		File << "#include \"NameTable.hpp\"\n";
+
 	if (Type == EFileType::SdkHpp)
 		File << "#include \"SDK/Basic.hpp\"\n";
 
@@ -1589,6 +1762,13 @@ void CppGenerator::Generate()
 	StreamType UnicodeLib(MainFolder / "UtfN.hpp");
 	GenerateUnicodeLib(UnicodeLib);
 
+	// Generate NameTable.hpp before any class, StaticClass() and StaticName() only use names that were written to it
+	if constexpr (Settings::CppGenerator::bGenerateNameTable)
+	{
+		StreamType NameTable(Subfolder / "NameTable.hpp");
+		GenerateNameTable(NameTable);
+	}
+
 	StreamType DebugAssertions;
 
 	if constexpr (Settings::Debug::bGenerateAssertionFile)
@@ -3434,6 +3614,15 @@ void CppGenerator::GenerateBasicFiles(StreamType& BasicHpp, StreamType& BasicCpp
 #include <type_traits>
 )";
 
+	if constexpr (CppSettings::bGenerateBatchedFunctionCalls || CppSettings::bGenerateGObjectsSnapshot)
+		CustomIncludes += "#include <vector>\n#include <atomic>\n";
+
+	if constexpr (CppSettings::bGenerateBatchedFunctionCalls)
+		CustomIncludes += "#include <mutex>\n";
+
+	if constexpr (CppSettings::bGenerateGObjectsSnapshot)
+		CustomIncludes += "#include <thread>\n#include <xmmintrin.h>\n";
+
 	WriteFileHead(BasicHpp, nullptr, EFileType::BasicHpp, "Basic file containing structs required by the SDK", CustomIncludes);
 	WriteFileHead(BasicCpp, nullptr, EFileType::BasicCpp, "Basic file containing function-implementations from Basic.hpp", "#include <Windows.h>");
 
@@ -3723,6 +3912,215 @@ ClassType* GetDefaultObjImpl()
 }
 )";
 
+	if constexpr (CppSettings::bGenerateNameTable)
+	{
+		BasicHpp << R"(
+namespace BasicFilesImpleUtils
+{
+	UClass* FindClassByFName(const FName& Name);
+}
+
+/* Implementation of 'UObject::StaticClass()' for classes in NameTable.hpp, compares FNames instead of strings */
+inline class UClass* GetStaticClassImplByFName(const FName& Name, class UClass*& StaticClass)
+{
+	if (StaticClass == nullptr)
+		StaticClass = BasicFilesImpleUtils::FindClassByFName(Name);
+
+	return StaticClass;
+}
+
+#define STATIC_CLASS_TABLE_IMPL(TableName, NameString) \
+{ \
+    static UClass* Clss = nullptr; \
+    return NameTable::IsValid() ? GetStaticClassImplByFName(TableName, Clss) : GetStaticClassImpl(NameString, Clss); \
+}
+
+#define STATIC_NAME_TABLE_IMPL(TableName, NameString) \
+{ \
+    static FName Name = FName(); \
+    return NameTable::IsValid() ? TableName : GetStaticName(NameString, Name); \
+}
+)";
+
+		BasicCpp << R"(
+class UClass* BasicFilesImpleUtils::FindClassByFName(const FName& Name)
+{
+	for (int i = 0; i < UObject::GObjects->Num(); ++i)
+	{
+		UObject* Object = UObject::GObjects->GetByIndex(i);
+
+		if (!Object)
+			continue;
+
+		if (Object->Name == Name && Object->HasTypeFlag(EClassCastFlags::Class))
+			return static_cast<UClass*>(Object);
+	}
+
+	return nullptr;
+}
+)";
+	}
+
+	if constexpr (CppSettings::bGenerateBatchedFunctionCalls)
+	{
+		BasicHpp << R"(
+namespace BasicFilesImpleUtils
+{
+	/* Calls 'Func' on every object with its own parameter block, the native-flag is only patched once for the entire batch */
+	void ProcessEventBatch(class UFunction* Func, bool bIsNativeFunc, class UObject* const* Objects, void* ParamBlocks, uint64 ParamsSize, uint64 NumCalls);
+}
+
+/*
+* Caches all UFunctions of a single class, which are all resolved by one pass over the class' 'Children' on the first lookup.
+*
+* Thread-safe, the first lookups of different threads are serialized until the table was resolved. Later lookups don't lock.
+*/
+class FFunctionTable
+{
+private:
+	std::vector<std::pair<std::string, class UFunction*>> Functions;
+	std::atomic<bool> bIsResolved = false;
+
+	std::mutex ResolveMutex;
+
+private:
+	void Resolve(const class UClass* Class, const char* ClassName);
+
+public:
+	class UFunction* Get(const class UClass* Class, const char* ClassName, const char* FuncName);
+};
+
+/*
+* Queues calls of a single UFunction, each with its own pre-filled parameter block, and dispatches them back-to-back.
+*
+* ParamsType is the 'Params::' struct of the function, its 'bIsNativeFunction' was taken from the UFunction when the SDK was generated.
+* Parameter blocks are stored contiguously and 'Reset()' keeps their memory, so an invoker which is reused every tick doesn't allocate
+* once it reached its peak size.
+*/
+template<typename ParamsType>
+class TBatchInvoker
+{
+private:
+	static constexpr bool bIsNativeFunc = ParamsType::bIsNativeFunction;
+
+private:
+	class UFunction* Func;
+
+	std::vector<class UObject*> Objects;
+	std::vector<ParamsType> ParamBlocks;
+
+public:
+	explicit TBatchInvoker(class UFunction* Function)
+		: Func(Function)
+	{
+	}
+
+public:
+	inline void Reserve(int32 NumCalls)
+	{
+		Objects.reserve(NumCalls);
+		ParamBlocks.reserve(NumCalls);
+	}
+
+	/* Queues a call on 'Object' and returns its parameter block to be filled in */
+	inline ParamsType& Add(class UObject* Object)
+	{
+		Objects.push_back(Object);
+		return ParamBlocks.emplace_back();
+	}
+
+	inline ParamsType& Add(class UObject* Object, const ParamsType& Parms)
+	{
+		Objects.push_back(Object);
+		return ParamBlocks.emplace_back(Parms);
+	}
+
+	/* Calls the function for every queued call, out-params and return values are written back into the parameter blocks */
+	inline void Dispatch()
+	{
+		if (!Func || Objects.empty())
+			return;
+
+		BasicFilesImpleUtils::ProcessEventBatch(Func, bIsNativeFunc, Objects.data(), ParamBlocks.data(), sizeof(ParamsType), Objects.size());
+	}
+
+	/* Removes all queued calls, but keeps the memory for the next batch */
+	inline void Reset()
+	{
+		Objects.clear();
+		ParamBlocks.clear();
+	}
+
+public:
+	inline int32 Num() const { return static_cast<int32>(Objects.size()); }
+
+	inline class UFunction* GetFunction() const { return Func; }
+
+	inline       ParamsType& GetParams(int32 Index)       { return ParamBlocks[Index]; }
+	inline const ParamsType& GetParams(int32 Index) const { return ParamBlocks[Index]; }
+};
+)";
+
+		BasicCpp << R"(
+void BasicFilesImpleUtils::ProcessEventBatch(class UFunction* Func, bool bIsNativeFunc, class UObject* const* Objects, void* ParamBlocks, uint64 ParamsSize, uint64 NumCalls)
+{
+	auto Flgs = Func->FunctionFlags;
+
+	if (bIsNativeFunc)
+		Func->FunctionFlags |= 0x400;
+
+	uint8* CurrentParams = static_cast<uint8*>(ParamBlocks);
+
+	for (uint64 i = 0; i < NumCalls; i++, CurrentParams += ParamsSize)
+	{
+		if (Objects[i])
+			Objects[i]->ProcessEvent(Func, CurrentParams);
+	}
+
+	Func->FunctionFlags = Flgs;
+}
+
+void FFunctionTable::Resolve(const class UClass* Class, const char* ClassName)
+{
+	for (const UStruct* Clss = Class; Clss; Clss = Clss->SuperStruct)
+	{
+		if (Clss->GetName() != ClassName)
+			continue;
+
+		for (UField* Field = Clss->Children; Field; Field = Field->Next)
+		{
+			if (Field->HasTypeFlag(EClassCastFlags::Function))
+				Functions.emplace_back(Field->GetName(), static_cast<class UFunction*>(Field));
+		}
+
+		/* Publishes 'Functions' to the threads that don't take the lock */
+		bIsResolved.store(true, std::memory_order_release);
+		return;
+	}
+}
+
+class UFunction* FFunctionTable::Get(const class UClass* Class, const char* ClassName, const char* FuncName)
+{
+	if (!bIsResolved.load(std::memory_order_acquire)) [[unlikely]]
+	{
+		std::scoped_lock Lock(ResolveMutex);
+
+		/* Another thread might have resolved the table while this one was waiting */
+		if (!bIsResolved.load(std::memory_order_relaxed))
+			Resolve(Class, ClassName);
+	}
+
+	for (const auto& [Name, Func] : Functions)
+	{
+		if (Name == FuncName)
+			return Func;
+	}
+
+	return nullptr;
+}
+)";
+	}
+
 	// Start class 'FUObjectItem'
 	PredefinedStruct FUObjectItem = PredefinedStruct{
 		.UniqueName = "FUObjectItem", .Size = Off::InSDK::ObjArray::FUObjectItemSize, .Alignment = alignof(void*), .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = false, .bIsUnion = false, .Super = nullptr
@@ -3994,6 +4392,225 @@ public:)";
 	// End class 'TUObjectArrayWrapper'
 
 
+	if constexpr (CppSettings::bGenerateGObjectsSnapshot)
+	{
+		const bool bIsChunkedObjectArray = Off::InSDK::ObjArray::ChunkSize > 0;
+
+		/* A fixed object-array is handled as a single chunk, that is large enough to hold every index */
+		const int32 SnapshotElementsPerChunk = bIsChunkedObjectArray ? Off::InSDK::ObjArray::ChunkSize : 0x7FFFFFFF;
+
+		BasicHpp << std::format(R"(
+/*
+* Read-only view of GObjects, that can be iterated from any thread.
+*
+* NumElements and the chunk-table are only read once, when the snapshot is taken. Objects which are added to GObjects
+* afterwards are not visited, so iterating the snapshot is safe while the engine keeps adding objects on another thread.
+*/
+class FGObjectsSnapshot
+{{
+public:
+	struct FEntry
+	{{
+		int32 Index;
+		class UObject* Object;
+	}};
+
+	/* Only stops at indices with a valid UObject* */
+	class FIterator
+	{{
+	private:
+		const FGObjectsSnapshot* Snapshot;
+		int32 Index;
+		int32 EndIndex;
+
+	public:
+		FIterator(const FGObjectsSnapshot* InSnapshot, int32 StartIndex, int32 InEndIndex)
+			: Snapshot(InSnapshot), Index(StartIndex), EndIndex(InEndIndex)
+		{{
+			SkipEmptyIndices();
+		}}
+
+	private:
+		inline void SkipEmptyIndices()
+		{{
+			for (; Index < EndIndex; Index++)
+			{{
+				if (Index + PrefetchDistance < EndIndex)
+					Snapshot->PrefetchClass(Index + PrefetchDistance);
+
+				if (Snapshot->GetByIndexUnchecked(Index))
+					return;
+			}}
+		}}
+
+	public:
+		inline FEntry operator*() const {{ return {{ Index, Snapshot->GetByIndexUnchecked(Index) }}; }}
+
+		inline FIterator& operator++() {{ ++Index; SkipEmptyIndices(); return *this; }}
+
+		inline bool operator==(const FIterator& Other) const {{ return Index == Other.Index; }}
+		inline bool operator!=(const FIterator& Other) const {{ return Index != Other.Index; }}
+	}};
+
+	/* Range of indices [BeginIndex, EndIndex) of a snapshot */
+	class FRange
+	{{
+	private:
+		const FGObjectsSnapshot* Snapshot;
+		int32 BeginIndex;
+		int32 EndIndex;
+
+	public:
+		FRange(const FGObjectsSnapshot* InSnapshot, int32 InBeginIndex, int32 InEndIndex)
+			: Snapshot(InSnapshot), BeginIndex(InBeginIndex), EndIndex(InEndIndex)
+		{{
+		}}
+
+	public:
+		inline FIterator begin() const {{ return FIterator(Snapshot, BeginIndex, EndIndex); }}
+		inline FIterator end()   const {{ return FIterator(Snapshot, EndIndex, EndIndex); }}
+	}};
+
+private:
+	static constexpr int32 ElementsPerChunk = 0x{:X};
+	static constexpr int32 ClassOffset = 0x{:X};
+
+	/* How many indices ahead the 'Class' of an object is prefetched */
+	static constexpr int32 PrefetchDistance = 0x8;
+
+private:
+	std::vector<struct FUObjectItem*> Chunks;
+	int32 NumElements = 0;
+
+public:
+	explicit FGObjectsSnapshot(const class TUObjectArray* ObjectArray);
+
+private:
+	inline class UObject* GetByIndexUnchecked(int32 Index) const
+	{{
+		struct FUObjectItem* Chunk = Chunks[Index / ElementsPerChunk];
+
+		return Chunk ? Chunk[Index % ElementsPerChunk].Object : nullptr;
+	}}
+
+	inline void PrefetchClass(int32 Index) const
+	{{
+		if (class UObject* Object = GetByIndexUnchecked(Index))
+			_mm_prefetch(reinterpret_cast<const char*>(Object) + ClassOffset, _MM_HINT_T0);
+	}}
+
+public:
+	inline int32 Num() const {{ return NumElements; }}
+
+	inline class UObject* GetByIndex(int32 Index) const
+	{{
+		if (Index < 0 || Index >= NumElements)
+			return nullptr;
+
+		return GetByIndexUnchecked(Index);
+	}}
+
+	/* Splits the snapshot into 'NumParts' ranges of equal size and returns the range at 'PartIndex' */
+	inline FRange Partition(int32 PartIndex, int32 NumParts) const
+	{{
+		if (NumParts <= 0 || PartIndex < 0 || PartIndex >= NumParts)
+			return FRange(this, 0, 0);
+
+		const int32 BeginIndex = static_cast<int32>((static_cast<int64>(NumElements) * PartIndex) / NumParts);
+		const int32 EndIndex = static_cast<int32>((static_cast<int64>(NumElements) * (PartIndex + 1)) / NumParts);
+
+		return FRange(this, BeginIndex, EndIndex);
+	}}
+
+	/* Calls 'Callback(int32 Index, UObject* Object)' for every object, split across 'NumThreads' threads. 0 uses one thread per hardware-thread. */
+	template<typename CallbackType>
+	inline void ParallelForEach(CallbackType Callback, int32 NumThreads = 0) const
+	{{
+		if (NumThreads <= 0)
+			NumThreads = static_cast<int32>(std::thread::hardware_concurrency());
+
+		if (NumThreads <= 1)
+		{{
+			for (const FEntry& Entry : *this)
+				Callback(Entry.Index, Entry.Object);
+
+			return;
+		}}
+
+		std::vector<std::thread> Workers;
+		Workers.reserve(NumThreads - 1);
+
+		for (int32 i = 1; i < NumThreads; i++)
+		{{
+			Workers.emplace_back([this, &Callback, i, NumThreads]() -> void
+			{{
+				for (const FEntry& Entry : Partition(i, NumThreads))
+					Callback(Entry.Index, Entry.Object);
+			}});
+		}}
+
+		for (const FEntry& Entry : Partition(0, NumThreads))
+			Callback(Entry.Index, Entry.Object);
+
+		for (std::thread& Worker : Workers)
+			Worker.join();
+	}}
+
+public:
+	inline FIterator begin() const {{ return FIterator(this, 0, NumElements); }}
+	inline FIterator end()   const {{ return FIterator(this, NumElements, NumElements); }}
+}};
+)", SnapshotElementsPerChunk, Off::UObject::Class);
+
+		BasicCpp << R"(
+FGObjectsSnapshot::FGObjectsSnapshot(const class TUObjectArray* ObjectArray)
+{
+	if (!ObjectArray)
+		return;
+
+	/* The engine only increases NumElements after the new item was written, the acquire-load makes those items visible to us */
+	NumElements = std::atomic_ref<int32>(const_cast<int32&>(ObjectArray->NumElements)).load(std::memory_order_acquire);
+)";
+
+		if (bIsChunkedObjectArray)
+		{
+			BasicCpp << R"(
+	struct FUObjectItem** ChunkTable = ObjectArray->GetDecrytedObjPtr();
+
+	if (!ChunkTable || NumElements <= 0)
+	{
+		NumElements = 0;
+		return;
+	}
+
+	const int32 NumRequiredChunks = (NumElements + ElementsPerChunk - 1) / ElementsPerChunk;
+	const int32 NumChunksToCopy = ObjectArray->NumChunks < NumRequiredChunks ? ObjectArray->NumChunks : NumRequiredChunks;
+
+	Chunks.assign(ChunkTable, ChunkTable + NumChunksToCopy);
+
+	if (NumElements > NumChunksToCopy * ElementsPerChunk)
+		NumElements = NumChunksToCopy * ElementsPerChunk;
+}
+)";
+		}
+		else
+		{
+			BasicCpp << R"(
+	struct FUObjectItem* Objects = ObjectArray->GetDecrytedObjPtr();
+
+	if (!Objects || NumElements <= 0)
+	{
+		NumElements = 0;
+		return;
+	}
+
+	Chunks.push_back(Objects);
+}
+)";
+		}
+	}
+
+
 
 	/* struct FStringData */
 	PredefinedStruct FStringData = PredefinedStruct{
@@ -5826,7 +6443,7 @@ using TActorBasedCycleFixup = CyclicDependencyFixupImpl::TCyclicClassFixup<Under
 void CppGenerator::GenerateUnrealContainers(StreamType& UEContainersHeader)
 {
 	WriteFileHead(UEContainersHeader, nullptr, EFileType::UnrealContainers, 
-		"Container implementations with iterators. See https://github.com/Fischsalat/UnrealContainers", "#include <string>\n#include <stdexcept>\n#include <iostream>\n#include <optional>\n#include \"UtfN.hpp\"");
+		"Container implementations with iterators. See https://github.com/Fischsalat/UnrealContainers", "#include <string>\n#include <stdexcept>\n#include <iostream>\n#include <optional>\n#include <bit>\n#include \"UtfN.hpp\"");
 
 
 	UEContainersHeader << R"(
@@ -5984,6 +6601,65 @@ namespace UC
 
 			inline bool IsValid() const { return GetData() && NumBits > 0; }
 
+		public:
+			/* Calls 'Callback(int32 FirstIndex, int32 NumBitsInRun)' for every run of consecutive set bits, in ascending order */
+			template<typename CallbackType>
+			inline void ForEachSetBitRun(CallbackType Callback) const
+			{
+				const uint32* Words = GetData();
+
+				if (!Words || NumBits <= 0)
+					return;
+
+				const int32 NumWords = (NumBits + NumBitsPerDWORD - 1) >> NumBitsPerDWORDLogTwo;
+				const int32 NumBitsInLastWord = NumBits & (NumBitsPerDWORD - 1);
+
+				int32 RunStartIndex = -1;
+
+				for (int32 WordIndex = 0; WordIndex < NumWords; WordIndex++)
+				{
+					uint32 Word = Words[WordIndex];
+
+					/* Bits past NumBits are not part of the array */
+					if (WordIndex == (NumWords - 1) && NumBitsInLastWord != 0)
+						Word &= (1U << NumBitsInLastWord) - 1;
+
+					/* The whole word either continues the current run, or contains no set bit at all */
+					if (Word == (RunStartIndex != -1 ? ~0U : 0U))
+						continue;
+
+					const int32 WordBaseIndex = WordIndex << NumBitsPerDWORDLogTwo;
+
+					for (int32 BitOffset = 0; BitOffset < NumBitsPerDWORD;)
+					{
+						const uint32 RemainingBits = Word >> BitOffset;
+
+						if (RunStartIndex == -1)
+						{
+							if (!RemainingBits)
+								break;
+
+							BitOffset += std::countr_zero(RemainingBits);
+							RunStartIndex = WordBaseIndex + BitOffset;
+						}
+						else
+						{
+							BitOffset += std::countr_one(RemainingBits);
+
+							/* The run continues into the next word */
+							if (BitOffset >= NumBitsPerDWORD)
+								break;
+
+							Callback(RunStartIndex, (WordBaseIndex + BitOffset) - RunStartIndex);
+							RunStartIndex = -1;
+						}
+					}
+				}
+
+				if (RunStartIndex != -1)
+					Callback(RunStartIndex, NumBits - RunStartIndex);
+			}
+
 		public:
 			inline bool operator[](int32 Index) const { VerifyIndex(Index); return GetData()[Index / NumBitsPerDWORD] & (1 << (Index & (NumBitsPerDWORD - 1))); }
 
@@ -6012,7 +6688,7 @@ namespace UC
 		{
 		private:
 			template<typename SetDataType>
-			friend class TSet;
+			friend class UC::TSet;
 
 		private:
 			SetType Value;
@@ -6465,9 +7141,26 @@ namespace UC
 	public:
 		const ContainerImpl::FBitArray& GetAllocationFlags() const { return AllocationFlags; }
 
+	public:
+		/* Calls 'Callback(int32 FirstIndex, int32 NumElements)' for every run of consecutive allocated elements */
+		template<typename CallbackType>
+		inline void ForEachAllocated(CallbackType Callback) const
+		{
+			const int32 NumIndices = NumAllocated();
+
+			AllocationFlags.ForEachSetBitRun([&](int32 FirstIndex, int32 NumInRun) -> void
+			{
+				/* The allocation-flags may have more bits than there are elements */
+				if (FirstIndex >= NumIndices)
+					return;
+
+				Callback(FirstIndex, FirstIndex + NumInRun > NumIndices ? NumIndices - FirstIndex : NumInRun);
+			});
+		}
+
 	public:
 		inline       SparseArrayElementType& operator[](int32 Index)       { VerifyIndex(Index); return *reinterpret_cast<SparseArrayElementType*>(&Data.GetUnsafe(Index).ElementData); }
-		inline const SparseArrayElementType& operator[](int32 Index) const { VerifyIndex(Index); return *reinterpret_cast<SparseArrayElementType*>(&Data.GetUnsafe(Index).ElementData); }
+		inline const SparseArrayElementType& operator[](int32 Index) const { VerifyIndex(Index); return *reinterpret_cast<const SparseArrayElementType*>(&Data.GetUnsafe(Index).ElementData); }
 
 		inline bool operator==(const TSparseArray<SparseArrayElementType>& Other) const { return Data == Other.Data; }
 		inline bool operator!=(const TSparseArray<SparseArrayElementType>& Other) const { return Data != Other.Data; }
@@ -6509,6 +7202,35 @@ namespace UC
 	private:
 		inline void VerifyIndex(int32 Index) const { if (!IsValidIndex(Index)) throw std::out_of_range("Index was out of range!"); }
 
+	private:
+		/* Walks the chain of the hash-bucket for 'KeyHash', the same way the engine does it. Returns -1 if no element matched. */
+		template<typename PredicateType>
+		inline int32 FindIndexByHash(uint32 KeyHash, PredicateType IsMatchingElement) const
+		{
+			if (HashSize <= 0 || !Hash.GetAllocation())
+				return -1;
+
+			const int32* Buckets = Hash.GetAllocation();
+
+			/* Limit the number of steps, a corrupted chain must not result in an endless loop */
+			int32 NumStepsLeft = Elements.NumAllocated();
+
+			for (int32 ElementId = Buckets[KeyHash & (HashSize - 1)]; Elements.IsValidIndex(ElementId) && NumStepsLeft > 0; NumStepsLeft--)
+			{
+				const SetDataType& Element = Elements[ElementId];
+
+				if (IsMatchingElement(Element.Value))
+					return ElementId;
+
+				ElementId = Element.HashNextId;
+			}
+
+			return -1;
+		}
+
+		template<typename KeyElementType, typename ValueElementType>
+		friend class TMap;
+
 	public:
 		inline int32 NumAllocated() const { return Elements.NumAllocated(); }
 
@@ -6522,6 +7244,39 @@ namespace UC
 	public:
 		const ContainerImpl::FBitArray& GetAllocationFlags() const { return Elements.GetAllocationFlags(); }
 
+	public:
+		/* Calls 'Callback(int32 FirstIndex, int32 NumElements)' for every run of consecutive allocated elements */
+		template<typename CallbackType>
+		inline void ForEachAllocated(CallbackType Callback) const { Elements.ForEachAllocated(Callback); }
+
+	public:
+		/* Lookup through the engine's hash-buckets. 'GetKeyHash' has to return the same hash as the engine's 'GetTypeHash' for this type. */
+		inline Iterators::TSetIterator<SetElementType> Find(const SetElementType& Key, uint32(*GetKeyHash)(const SetElementType& Key), bool(*Equals)(const SetElementType& LeftKey, const SetElementType& RightKey)) const
+		{
+			const int32 Index = FindIndexByHash(GetKeyHash(Key), [&](const SetElementType& Element) -> bool { return Equals(Element, Key); });
+
+			return Iterators::TSetIterator<SetElementType>(*this, GetAllocationFlags(), Index != -1 ? Index : NumAllocated());
+		}
+
+		inline Iterators::TSetIterator<SetElementType> Find(const SetElementType& Key, uint32(*GetKeyHash)(const SetElementType& Key)) const
+			requires std::equality_comparable<SetElementType>
+		{
+			const int32 Index = FindIndexByHash(GetKeyHash(Key), [&](const SetElementType& Element) -> bool { return Element == Key; });
+
+			return Iterators::TSetIterator<SetElementType>(*this, GetAllocationFlags(), Index != -1 ? Index : NumAllocated());
+		}
+
+		inline bool Contains(const SetElementType& Key, uint32(*GetKeyHash)(const SetElementType& Key), bool(*Equals)(const SetElementType& LeftKey, const SetElementType& RightKey)) const
+		{
+			return FindIndexByHash(GetKeyHash(Key), [&](const SetElementType& Element) -> bool { return Equals(Element, Key); }) != -1;
+		}
+
+		inline bool Contains(const SetElementType& Key, uint32(*GetKeyHash)(const SetElementType& Key)) const
+			requires std::equality_comparable<SetElementType>
+		{
+			return FindIndexByHash(GetKeyHash(Key), [&](const SetElementType& Element) -> bool { return Element == Key; }) != -1;
+		}
+
 	public:
 		inline       SetElementType& operator[] (int32 Index)       { return Elements[Index].Value; }
 		inline const SetElementType& operator[] (int32 Index) const { return Elements[Index].Value; }
@@ -6559,6 +7314,11 @@ namespace UC
 	public:
 		const ContainerImpl::FBitArray& GetAllocationFlags() const { return Elements.GetAllocationFlags(); }
 
+	public:
+		/* Calls 'Callback(int32 FirstIndex, int32 NumElements)' for every run of consecutive allocated elements */
+		template<typename CallbackType>
+		inline void ForEachAllocated(CallbackType Callback) const { Elements.ForEachAllocated(Callback); }
+
 	public:
 		inline decltype(auto) Find(const KeyElementType& Key, bool(*Equals)(const KeyElementType& LeftKey, const KeyElementType& RightKey))
 		{
@@ -6571,6 +7331,33 @@ namespace UC
 			return end(*this);
 		}
 
+		/* Lookup through the engine's hash-buckets. 'GetKeyHash' has to return the same hash as the engine's 'GetTypeHash' for the key-type. */
+		inline Iterators::TMapIterator<KeyElementType, ValueElementType> Find(const KeyElementType& Key, uint32(*GetKeyHash)(const KeyElementType& Key), bool(*Equals)(const KeyElementType& LeftKey, const KeyElementType& RightKey)) const
+		{
+			const int32 Index = Elements.FindIndexByHash(GetKeyHash(Key), [&](const ElementType& Element) -> bool { return Equals(Element.Key(), Key); });
+
+			return Iterators::TMapIterator<KeyElementType, ValueElementType>(*this, GetAllocationFlags(), Index != -1 ? Index : NumAllocated());
+		}
+
+		inline Iterators::TMapIterator<KeyElementType, ValueElementType> Find(const KeyElementType& Key, uint32(*GetKeyHash)(const KeyElementType& Key)) const
+			requires std::equality_comparable<KeyElementType>
+		{
+			const int32 Index = Elements.FindIndexByHash(GetKeyHash(Key), [&](const ElementType& Element) -> bool { return Element.Key() == Key; });
+
+			return Iterators::TMapIterator<KeyElementType, ValueElementType>(*this, GetAllocationFlags(), Index != -1 ? Index : NumAllocated());
+		}
+
+		inline bool Contains(const KeyElementType& Key, uint32(*GetKeyHash)(const KeyElementType& Key), bool(*Equals)(const KeyElementType& LeftKey, const KeyElementType& RightKey)) const
+		{
+			return Elements.FindIndexByHash(GetKeyHash(Key), [&](const ElementType& Element) -> bool { return Equals(Element.Key(), Key); }) != -1;
+		}
+
+		inline bool Contains(const KeyElementType& Key, uint32(*GetKeyHash)(const KeyElementType& Key)) const
+			requires std::equality_comparable<KeyElementType>
+		{
+			return Elements.FindIndexByHash(GetKeyHash(Key), [&](const ElementType& Element) -> bool { return Element.Key() == Key; }) != -1;
+		}
+
 	public:
 		inline       ElementType& operator[] (int32 Index)       { return Elements[Index]; }
 		inline const ElementType& operator[] (int32 Index) const { return Elements[Index]; }
@@ -6585,48 +7372,42 @@ namespace UC
 
 	namespace Iterators
 	{
-		class FRelativeBitReference
+		class FSetBitIterator
 		{
-		protected:
+		private:
 			static constexpr int32 NumBitsPerDWORD = 32;
 			static constexpr int32 NumBitsPerDWORDLogTwo = 5;
 
-		public:
-			inline explicit FRelativeBitReference(int32 BitIndex)
-				: WordIndex(BitIndex >> NumBitsPerDWORDLogTwo)
-				, Mask(1 << (BitIndex & (NumBitsPerDWORD - 1)))
-			{
-			}
-
-			int32  WordIndex;
-			uint32 Mask;
-		};
-
-		class FSetBitIterator : public FRelativeBitReference
-		{
 		private:
 			const ContainerImpl::FBitArray& Array;
 
-			uint32 UnvisitedBitMask;
+			/* Bits of the current word that were not visited yet */
+			uint32 UnvisitedBits;
+			int32 WordIndex;
 			int32 CurrentBitIndex;
-			int32 BaseBitIndex;
 
 		public:
 			explicit FSetBitIterator(const ContainerImpl::FBitArray& InArray, int32 StartIndex = 0)
-				: FRelativeBitReference(StartIndex)
-				, Array(InArray)
-				, UnvisitedBitMask((~0U) << (StartIndex & (NumBitsPerDWORD - 1)))
+				: Array(InArray)
+				, UnvisitedBits(0)
+				, WordIndex(StartIndex >> NumBitsPerDWORDLogTwo)
 				, CurrentBitIndex(StartIndex)
-				, BaseBitIndex(StartIndex & ~(NumBitsPerDWORD - 1))
 			{
-				if (StartIndex != Array.Num())
-					FindFirstSetBit();
+				if (StartIndex >= Array.Num())
+				{
+					CurrentBitIndex = Array.Num();
+					return;
+				}
+
+				UnvisitedBits = Array.GetData()[WordIndex] & ((~0U) << (StartIndex & (NumBitsPerDWORD - 1)));
+				FindFirstSetBit();
 			}
 
 		public:
 			inline FSetBitIterator& operator++()
 			{
-				UnvisitedBitMask &= ~this->Mask;
+				/* Clear the lowest set bit, which is the one we're currently at */
+				UnvisitedBits &= UnvisitedBits - 1;
 
 				FindFirstSetBit();
 
@@ -6645,28 +7426,21 @@ namespace UC
 			{
 				const uint32* ArrayData = Array.GetData();
 				const int32   ArrayNum = Array.Num();
-				const int32   LastWordIndex = (ArrayNum - 1) / NumBitsPerDWORD;
+				const int32   NumWords = (ArrayNum + NumBitsPerDWORD - 1) >> NumBitsPerDWORDLogTwo;
 
-				uint32 RemainingBitMask = ArrayData[this->WordIndex] & UnvisitedBitMask;
-				while (!RemainingBitMask)
+				/* Skip whole words without any allocated element */
+				while (!UnvisitedBits)
 				{
-					++this->WordIndex;
-					BaseBitIndex += NumBitsPerDWORD;
-					if (this->WordIndex > LastWordIndex)
+					if (++WordIndex >= NumWords)
 					{
 						CurrentBitIndex = ArrayNum;
 						return;
 					}
 
-					RemainingBitMask = ArrayData[this->WordIndex];
-					UnvisitedBitMask = ~0;
+					UnvisitedBits = ArrayData[WordIndex];
 				}
 
-				const uint32 NewRemainingBitMask = RemainingBitMask & (RemainingBitMask - 1);
-
-				this->Mask = NewRemainingBitMask ^ RemainingBitMask;
-
-				CurrentBitIndex = BaseBitIndex + NumBitsPerDWORD - 1 - ContainerImpl::HelperFunctions::CountLeadingZeros(this->Mask);
+				CurrentBitIndex = (WordIndex << NumBitsPerDWORDLogTwo) + std::countr_zero(UnvisitedBits);
 
 				if (CurrentBitIndex > ArrayNum)
 					CurrentBitIndex = ArrayNum;
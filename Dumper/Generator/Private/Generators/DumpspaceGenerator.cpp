@@ -1,5 +1,9 @@
+#include <mutex>
+
 #include "Generators/DumpspaceGenerator.h"
 
+#include "TaskGraph.h"
+
 std::string DumpspaceGenerator::GetStructPrefixedName(const StructWrapper& Struct)
 {
 	if (Struct.IsFunction())
@@ -52,90 +56,63 @@ DSGen::EType DumpspaceGenerator::GetMemberEType(const PropertyWrapper& Property)
 
 DSGen::EType DumpspaceGenerator::GetMemberEType(UEProperty Prop)
 {
-	if (Prop.IsA(EClassCastFlags::EnumProperty))
+	switch (Prop.GetPropertyKind())
 	{
+	case EPropertyKind::Enum:
 		return DSGen::ET_Enum;
-	}
-	else if (Prop.IsA(EClassCastFlags::ByteProperty))
-	{
+	case EPropertyKind::Byte:
 		if (Prop.Cast<UEByteProperty>().GetEnum())
 			return DSGen::ET_Enum;
-	}
-	//else if (Prop.IsA(EClassCastFlags::ClassProperty))
-	//{
+
+		return DSGen::ET_Default;
+	//case EPropertyKind::Class:
 	//	/* Check if this is a UClass*, not TSubclassof<UObject> */
 	//	if (!Prop.Cast<UEClassProperty>().HasPropertyFlags(EPropertyFlags::UObjectWrapper))
 	//		return DSGen::ET_Class; 
-	//}
-	else if (Prop.IsA(EClassCastFlags::ObjectProperty))
-	{
+	case EPropertyKind::Class:
+	case EPropertyKind::Object:
 		return DSGen::ET_Class;
-	}
-	else if (Prop.IsA(EClassCastFlags::StructProperty))
-	{
+	case EPropertyKind::Struct:
 		return DSGen::ET_Struct;
-	}
-	else if (Prop.IsType(EClassCastFlags::ArrayProperty | EClassCastFlags::MapProperty | EClassCastFlags::SetProperty))
-	{
+	case EPropertyKind::Array:
+	case EPropertyKind::Map:
+	case EPropertyKind::Set:
 		return DSGen::ET_Class;
+	default:
+		return DSGen::ET_Default;
 	}
-
-	return DSGen::ET_Default;
 }
 
 std::string DumpspaceGenerator::GetMemberTypeStr(UEProperty Property, std::string& OutExtendedType, std::vector<DSGen::MemberType>& OutSubtypes)
 {
 	UEProperty Member = Property;
 
-	auto [Class, FieldClass] = Member.GetClass();
-
-	EClassCastFlags Flags = Class ? Class.GetCastFlags() : FieldClass.GetCastFlags();
-
-	if (Flags & EClassCastFlags::ByteProperty)
+	switch (Member.GetPropertyKind())
 	{
+	case EPropertyKind::Byte:
 		if (UEEnum Enum = Member.Cast<UEByteProperty>().GetEnum())
 			return GetEnumPrefixedName(Enum);
 
 		return "uint8";
-	}
-	else if (Flags & EClassCastFlags::UInt16Property)
-	{
+	case EPropertyKind::UInt16:
 		return "uint16";
-	}
-	else if (Flags & EClassCastFlags::UInt32Property)
-	{
+	case EPropertyKind::UInt32:
 		return "uint32";
-	}
-	else if (Flags & EClassCastFlags::UInt64Property)
-	{
+	case EPropertyKind::UInt64:
 		return "uint64";
-	}
-	else if (Flags & EClassCastFlags::Int8Property)
-	{
+	case EPropertyKind::Int8:
 		return "int8";
-	}
-	else if (Flags & EClassCastFlags::Int16Property)
-	{
+	case EPropertyKind::Int16:
 		return "int16";
-	}
-	else if (Flags & EClassCastFlags::IntProperty)
-	{
+	case EPropertyKind::Int:
 		return "int32";
-	}
-	else if (Flags & EClassCastFlags::Int64Property)
-	{
+	case EPropertyKind::Int64:
 		return "int64";
-	}
-	else if (Flags & EClassCastFlags::FloatProperty)
-	{
+	case EPropertyKind::Float:
 		return "float";
-	}
-	else if (Flags & EClassCastFlags::DoubleProperty)
-	{
+	case EPropertyKind::Double:
 		return "double";
-	}
-	else if (Flags & EClassCastFlags::ClassProperty)
-	{
+	case EPropertyKind::Class:
 		if (Member.HasPropertyFlags(EPropertyFlags::UObjectWrapper))
 		{
 			OutSubtypes.emplace_back(GetMemberType(Member.Cast<UEClassProperty>().GetMetaClass()));
@@ -146,37 +123,25 @@ std::string DumpspaceGenerator::GetMemberTypeStr(UEProperty Property, std::strin
 		OutExtendedType = "*";
 
 		return "UClass";
-	}
-	else if (Flags & EClassCastFlags::NameProperty)
-	{
+	case EPropertyKind::Name:
 		return "FName";
-	}
-	else if (Flags & EClassCastFlags::StrProperty)
-	{
+	case EPropertyKind::Str:
 		return "FString";
-	}
-	else if (Flags & EClassCastFlags::TextProperty)
-	{
+	case EPropertyKind::Text:
 		return "FText";
-	}
-	else if (Flags & EClassCastFlags::BoolProperty)
-	{
+	case EPropertyKind::Bool:
 		return Member.Cast<UEBoolProperty>().IsNativeBool() ? "bool" : "uint8";
-	}
-	else if (Flags & EClassCastFlags::StructProperty)
+	case EPropertyKind::Struct:
 	{
 		const StructWrapper& UnderlayingStruct = Member.Cast<UEStructProperty>().GetUnderlayingStruct();
 
 		return GetStructPrefixedName(UnderlayingStruct);
 	}
-	else if (Flags & EClassCastFlags::ArrayProperty)
-	{
+	case EPropertyKind::Array:
 		OutSubtypes.push_back(GetMemberType(Member.Cast<UEArrayProperty>().GetInnerProperty()));
 
 		return "TArray";
-	}
-	else if (Flags & EClassCastFlags::WeakObjectProperty)
-	{
+	case EPropertyKind::WeakObject:
 		if (UEClass PropertyClass = Member.Cast<UEWeakObjectProperty>().GetPropertyClass()) 
 		{
 			OutSubtypes.push_back(GetMemberType(PropertyClass));
@@ -187,9 +152,7 @@ std::string DumpspaceGenerator::GetMemberTypeStr(UEProperty Property, std::strin
 		}
 
 		return "TWeakObjectPtr";
-	}
-	else if (Flags & EClassCastFlags::LazyObjectProperty)
-	{
+	case EPropertyKind::LazyObject:
 		if (UEClass PropertyClass = Member.Cast<UELazyObjectProperty>().GetPropertyClass())
 		{
 			OutSubtypes.push_back(GetMemberType(PropertyClass));
@@ -200,9 +163,7 @@ std::string DumpspaceGenerator::GetMemberTypeStr(UEProperty Property, std::strin
 		}
 
 		return "TLazyObjectPtr";
-	}
-	else if (Flags & EClassCastFlags::SoftClassProperty)
-	{
+	case EPropertyKind::SoftClass:
 		if (UEClass PropertyClass = Member.Cast<UESoftClassProperty>().GetPropertyClass())
 		{
 			OutSubtypes.push_back(GetMemberType(PropertyClass));
@@ -213,9 +174,7 @@ std::string DumpspaceGenerator::GetMemberTypeStr(UEProperty Property, std::strin
 		}
 
 		return "TSoftClassPtr";
-	}
-	else if (Flags & EClassCastFlags::SoftObjectProperty)
-	{
+	case EPropertyKind::SoftObject:
 		if (UEClass PropertyClass = Member.Cast<UESoftObjectProperty>().GetPropertyClass())
 		{
 			OutSubtypes.push_back(GetMemberType(PropertyClass));
@@ -226,47 +185,36 @@ std::string DumpspaceGenerator::GetMemberTypeStr(UEProperty Property, std::strin
 		}
 
 		return "TSoftObjectPtr";
-	}
-	else if (Flags & EClassCastFlags::ObjectProperty)
-	{
+	case EPropertyKind::Object:
 		OutExtendedType = "*";
 
 		if (UEClass PropertyClass = Member.Cast<UEObjectProperty>().GetPropertyClass())
 			return GetStructPrefixedName(PropertyClass);
 		
 		return "UObject";
-	}
-	else if (Settings::EngineCore::bEnableEncryptedObjectPropertySupport && Flags & EClassCastFlags::ObjectPropertyBase && Member.GetSize() == 0x10)
-	{
+	case EPropertyKind::ObjectBase:
+		if (!Settings::EngineCore::bEnableEncryptedObjectPropertySupport || Member.GetSize() != 0x10)
+			break;
+
 		if (UEClass PropertyClass = Member.Cast<UEObjectProperty>().GetPropertyClass())
 			return std::format("TEncryptedObjPtr<class {}>", GetStructPrefixedName(PropertyClass));
 
 		return "TEncryptedObjPtr<class UObject>";
-	}
-	else if (Flags & EClassCastFlags::MapProperty)
-	{
-		UEMapProperty MemberAsMapProperty = Member.Cast<UEMapProperty>();
-
+	case EPropertyKind::Map:
 		OutSubtypes.emplace_back(GetMemberType(Member.Cast<UEMapProperty>().GetKeyProperty()));
 		OutSubtypes.emplace_back(GetMemberType(Member.Cast<UEMapProperty>().GetValueProperty()));
 
 		return "TMap";
-	}
-	else if (Flags & EClassCastFlags::SetProperty)
-	{
+	case EPropertyKind::Set:
 		OutSubtypes.emplace_back(GetMemberType(Member.Cast<UESetProperty>().GetElementProperty()));
 
 		return "TSet";
-	}
-	else if (Flags & EClassCastFlags::EnumProperty)
-	{
+	case EPropertyKind::Enum:
 		if (UEEnum Enum = Member.Cast<UEEnumProperty>().GetEnum())
 			return GetEnumPrefixedName(Enum);
 
 		return "NamelessEnumIGuessIdkWhatToPutHereWithRegardsTheGuyFromDumper7";
-	}
-	else if (Flags & EClassCastFlags::InterfaceProperty)
-	{
+	case EPropertyKind::Interface:
 		if (UEClass PropertyClass = Member.Cast<UEInterfaceProperty>().GetPropertyClass())
 		{
 			OutSubtypes.push_back(GetMemberType(PropertyClass));
@@ -277,10 +225,7 @@ std::string DumpspaceGenerator::GetMemberTypeStr(UEProperty Property, std::strin
 		}
 
 		return "TScriptInterface";
-	}
-	else if (Flags & EClassCastFlags::FieldPathProperty)
-	{
-
+	case EPropertyKind::FieldPath:
 		if (Settings::Internal::bIsObjPtrInsteadOfFieldPathProperty)
 		{
 			OutExtendedType = "*";
@@ -301,20 +246,18 @@ std::string DumpspaceGenerator::GetMemberTypeStr(UEProperty Property, std::strin
 		}
 
 		return "TFieldPath";
-	}
-	else if (Flags & EClassCastFlags::OptionalProperty)
-	{
-		UEProperty ValueProperty = Member.Cast<UEOptionalProperty>().GetValueProperty();
-
-		OutSubtypes.push_back(GetMemberType(ValueProperty));
+	case EPropertyKind::Optional:
+		OutSubtypes.push_back(GetMemberType(Member.Cast<UEOptionalProperty>().GetValueProperty()));
 
 		return "TOptional";
+	default:
+		break;
 	}
-	else
-	{
-		/* When changing this also change 'GetUnknownProperties()' */
-		return (Class ? Class.GetCppName() : FieldClass.GetCppName()) + "_";
-	}
+
+	auto [Class, FieldClass] = Member.GetClass();
+
+	/* When changing this also change 'GetUnknownProperties()' */
+	return (Class ? Class.GetCppName() : FieldClass.GetCppName()) + "_";
 }
 
 DSGen::MemberType DumpspaceGenerator::GetMemberType(const StructWrapper& Struct)
@@ -481,43 +424,92 @@ void DumpspaceGenerator::Generate()
 	/* Add offsets for GObjects, GNames, GWorld, AppendString, PrcessEvent and ProcessEventIndex*/
 	GeneratedStaticOffsets();
 
-	// Generates all packages and writes them to files
+	struct PackageContents
+	{
+		const std::vector<int32>* Enums;
+
+		/* Structs followed by classes, both in dependency order */
+		std::vector<int32> StructsAndClasses;
+	};
+
+	struct GeneratedPackage
+	{
+		std::vector<DSGen::EnumHolder> Enums;
+		std::vector<DSGen::ClassHolder> StructsAndClasses;
+
+		bool bIsGenerated = false;
+	};
+
+	/* Non-empty packages with their structs and classes in dependency order, indexable by the workers and fixing the order packages are baked in */
+	std::vector<PackageContents> Packages;
+
 	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
 	{
 		if (Package.IsEmpty())
 			continue;
 
-		/*
-		* Generate classes/structs/enums/functions directly into the respective files
-		*
-		* Note: Some filestreams aren't opened but passed as parameters anyway because the function demands it, they are not used if they are closed
-		*/
-		for (int32 EnumIdx : Package.GetEnums())
-		{
-			DSGen::EnumHolder Enum = GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx));
-			DSGen::bakeEnum(Enum);
-		}
+		PackageContents& Contents = Packages.emplace_back();
+		Contents.Enums = &Package.GetEnums();
 
-		DependencyManager::OnVisitCallbackType GenerateClassOrStructCallback = [&](int32 Index) -> void
+		DependencyManager::OnVisitCallbackType AddStructOrClassCallback = [&](int32 Index) -> void
 		{
-			DSGen::ClassHolder StructOrClass = GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index));
-			DSGen::bakeStructOrClass(StructOrClass);
+			Contents.StructsAndClasses.push_back(Index);
 		};
 
 		if (Package.HasStructs())
-		{
-			const DependencyManager& Structs = Package.GetSortedStructs();
-
-			Structs.VisitAllNodesWithCallback(GenerateClassOrStructCallback);
-		}
+			Package.GetSortedStructs().VisitAllNodesWithCallback(AddStructOrClassCallback);
 
 		if (Package.HasClasses())
+			Package.GetSortedClasses().VisitAllNodesWithCallback(AddStructOrClassCallback);
+	}
+
+	/*
+	* Packages are generated concurrently, but baked strictly in the order they were collected in. Whichever thread completes the next package
+	* in that order bakes it, together with any following packages that are already done. The files are identical to a single-threaded run.
+	*/
+	std::vector<GeneratedPackage> Generated(Packages.size());
+
+	std::mutex BakeMutex;
+	size_t NextPackageToBake = 0x0;
+
+	ParallelFor(Packages.size(), [&](size_t PackageIdx) -> void
+	{
+		/* The lookup is per thread, see MemberManager::SetPredefinedMemberLookupPtr() */
+		MemberManager::SetPredefinedMemberLookupPtr(&PredefinedMembers);
+
+		const PackageContents& Contents = Packages[PackageIdx];
+
+		GeneratedPackage Result;
+		Result.Enums.reserve(Contents.Enums->size());
+		Result.StructsAndClasses.reserve(Contents.StructsAndClasses.size());
+
+		for (int32 EnumIdx : *Contents.Enums)
+			Result.Enums.push_back(GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx)));
+
+		for (int32 StructIdx : Contents.StructsAndClasses)
+			Result.StructsAndClasses.push_back(GenerateStruct(ObjectArray::GetByIndex<UEStruct>(StructIdx)));
+
+		Result.bIsGenerated = true;
+
+		std::scoped_lock Lock(BakeMutex);
+
+		Generated[PackageIdx] = std::move(Result);
+
+		for (; NextPackageToBake < Generated.size() && Generated[NextPackageToBake].bIsGenerated; NextPackageToBake++)
 		{
-			const DependencyManager& Classes = Package.GetSortedClasses();
+			GeneratedPackage& ToBake = Generated[NextPackageToBake];
 
-			Classes.VisitAllNodesWithCallback(GenerateClassOrStructCallback);
+			for (DSGen::EnumHolder& Enum : ToBake.Enums)
+				DSGen::bakeEnum(Enum);
+
+			for (DSGen::ClassHolder& StructOrClass : ToBake.StructsAndClasses)
+				DSGen::bakeStructOrClass(StructOrClass);
+
+			/* Free the holders right away, only packages waiting on an earlier one are kept around */
+			ToBake.Enums = {};
+			ToBake.StructsAndClasses = {};
 		}
-	}
+	});
 
 	DSGen::dump();
 }
@@ -5,13 +5,19 @@
 #include "Managers/MemberManager.h"
 #include "Managers/PackageManager.h"
 
+#include "Unreal/NameArray.h"
+#include "OffsetFinder/StaticOffsets.h"
+
 #include "HashStringTable.h"
 #include "Utils.h"
+#include "TaskGraph.h"
+#include "Profiler/Profiler.h"
 
 #include "Platform.h"
 #include "Json/json.hpp"
 
 #include <fstream>
+#include <chrono>
 
 inline void InitSettings()
 {
@@ -42,38 +48,104 @@ void Generator::InitEngineCore()
 	/* Multiversus [Unsupported, weird GObjects-struct] */
 	//InitObjectArrayDecryption([](void* ObjPtr) -> uint8* { return reinterpret_cast<uint8*>(uint64(ObjPtr) ^ 0x1B5DEAFD6B4068C); });
 
-	ObjectArray::Init();
+	{
+		Profiler::ScopedTimer Timer("InitEngineCore", "ObjectArray::Init");
+		ObjectArray::Init();
+	}
+
+	if (!Settings::Config::PrecomputedOffsetsPath.empty())
+	{
+		Profiler::ScopedTimer Timer("InitEngineCore", "StaticOffsets::LoadAndValidate");
+		StaticOffsets::LoadAndValidate(Settings::Config::PrecomputedOffsetsPath);
+	}
+
+	{
+		Profiler::ScopedTimer Timer("InitEngineCore", "FName::Init");
+
+		if (StaticOffsets::AppendString != 0x0)
+		{
+			FName::Init(StaticOffsets::AppendString, FName::EOffsetOverrideType::AppendString);
+			NameArray::SetGNamesWithoutCommitting();
+		}
+		else
+		{
+			CALL_PLATFORM_SPECIFIC_FUNCTION(FName::Init);
+		}
+	}
 
-	CALL_PLATFORM_SPECIFIC_FUNCTION(FName::Init);
+	{
+		Profiler::ScopedTimer Timer("InitEngineCore", "Off::Init");
+		Off::Init();
+		PropertySizes::Init();
+	}
 
-	Off::Init();
-	PropertySizes::Init();
+	{
+		Profiler::ScopedTimer Timer("InitEngineCore", "InitPE");
 
-	CALL_PLATFORM_SPECIFIC_FUNCTION(Off::InSDK::ProcessEvent::InitPE); // Must be at this position, relies on offsets initialized in Off::Init()
+		// Must be at this position, relies on offsets initialized in Off::Init()
+		if (const int32 PrecomputedPEIndex = StaticOffsets::FindProcessEventIndex(); PrecomputedPEIndex >= 0)
+		{
+			Off::InSDK::ProcessEvent::InitPE(PrecomputedPEIndex);
+		}
+		else
+		{
+			CALL_PLATFORM_SPECIFIC_FUNCTION(Off::InSDK::ProcessEvent::InitPE);
+		}
+	}
 
-	Off::InSDK::World::InitGWorld(); // Must be at this position, relies on offsets initialized in Off::Init()
+	{
+		Profiler::ScopedTimer Timer("InitEngineCore", "InitGWorld");
+		Off::InSDK::World::InitGWorld(); // Must be at this position, relies on offsets initialized in Off::Init()
+	}
 
-	Off::InSDK::Text::InitTextOffsets(); // Must be at this position, relies on offsets initialized in Off::InitPE()
+	{
+		Profiler::ScopedTimer Timer("InitEngineCore", "InitTextOffsets");
+		Off::InSDK::Text::InitTextOffsets(); // Must be at this position, relies on offsets initialized in Off::InitPE()
+	}
 
 	InitSettings();
 }
 
 void Generator::InitInternal()
 {
+	/*
+	* The managers only read from the ObjectArray and each of them writes to its own static tables, so managers that don't depend on each other are
+	* initialized concurrently. Shared lazily-initialized state in the engine-wrappers (eg. UEObject::GetCppName) must be thread-safe for this.
+	*
+	* PackageManager::Init --+
+	*                         +--> PackageManager::PostInit
+	* StructManager::Init ----+
+	* EnumManager::Init
+	* MemberManager::Init
+	*/
+	TaskGraph InitGraph;
+
 	// Initialize PackageManager with all packages, their names, structs, classes enums, functions and dependencies
-	PackageManager::Init();
+	const auto PackageInit = InitGraph.AddTask("PackageManager::Init", &PackageManager::Init);
 
 	// Initialize StructManager with all structs and their names
-	StructManager::Init();
-	
+	const auto StructInit = InitGraph.AddTask("StructManager::Init", &StructManager::Init);
+
 	// Initialize EnumManager with all enums and their names
-	EnumManager::Init();
-	
+	InitGraph.AddTask("EnumManager::Init", &EnumManager::Init);
+
 	// Initialized all Member-Name collisions
-	MemberManager::Init();
+	InitGraph.AddTask("MemberManager::Init", &MemberManager::Init);
 
 	// Post-Initialize PackageManager after StructManager has been initialized. 'PostInit()' handles Cyclic-Dependencies detection
-	PackageManager::PostInit();
+	InitGraph.AddTask("PackageManager::PostInit", &PackageManager::PostInit, { PackageInit, StructInit });
+
+	const auto InitStartTime = std::chrono::high_resolution_clock::now();
+
+	InitGraph.Run();
+
+	std::chrono::duration<double, std::milli> InitTime = std::chrono::high_resolution_clock::now() - InitStartTime;
+
+	for (const TaskGraph::TaskTiming& Timing : InitGraph.GetTimings())
+		Profiler::AddPhase("InitInternal", Timing.Name, Timing.StartTime, Timing.EndTime);
+
+	InitGraph.PrintTimings("InitInternal");
+	std::cerr << std::format("Initializing managers took ({:.2f}ms)\n\n", InitTime.count());
 }
 
 bool Generator::SetupDumperFolder()
@@ -107,6 +179,48 @@ bool Generator::SetupDumperFolder()
 	return true;
 }
 
+bool Generator::SetupGeneration()
+{
+	if (!DumperFolder.empty())
+		return true;
+
+	if (!SetupDumperFolder())
+		return false;
+
+	if (!bDumpedGObjects)
+	{
+		Profiler::ScopedTimer Timer("Generate", "DumpObjects");
+
+		bDumpedGObjects = true;
+		ObjectArray::DumpObjects(DumperFolder);
+
+		if (Settings::Internal::bUseFProperty)
+			ObjectArray::DumpObjectsWithProperties(DumperFolder);
+	}
+
+	if (!bDumepdEditorOnlyMetadata)
+	{
+		bDumepdEditorOnlyMetadata = true;
+		DumpEditorOnlyMetadata(DumperFolder);
+	}
+
+	return true;
+}
+
+uint64 Generator::GetFolderSize(const fs::path& Folder)
+{
+	uint64 TotalSize = 0x0;
+
+	std::error_code Error;
+	for (const fs::directory_entry& Entry : fs::recursive_directory_iterator(Folder, Error))
+	{
+		if (Entry.is_regular_file(Error))
+			TotalSize += Entry.file_size(Error);
+	}
+
+	return TotalSize;
+}
+
 bool Generator::SetupFolders(std::string& FolderName, fs::path& OutFolder)
 {
 	fs::path Dummy;
@@ -11,144 +11,75 @@
 
 EMappingsTypeFlags MappingGenerator::GetMappingType(UEProperty Property)
 {
-	auto [Class, FieldClass] = Property.GetClass();
-
-	EClassCastFlags Flags = Class ? Class.GetCastFlags() : FieldClass.GetCastFlags();
-
-	if (Flags & EClassCastFlags::ByteProperty)
+	switch (Property.GetPropertyKind())
 	{
+	case EPropertyKind::Byte:
 		return EMappingsTypeFlags::ByteProperty;
-	}
-	else if (Flags & EClassCastFlags::UInt16Property)
-	{
+	case EPropertyKind::UInt16:
 		return EMappingsTypeFlags::UInt16Property;
-	}
-	else if (Flags & EClassCastFlags::UInt32Property)
-	{
+	case EPropertyKind::UInt32:
 		return EMappingsTypeFlags::UInt32Property;
-	}
-	else if (Flags & EClassCastFlags::UInt64Property)
-	{
+	case EPropertyKind::UInt64:
 		return EMappingsTypeFlags::UInt64Property;
-	}
-	else if (Flags & EClassCastFlags::Int8Property)
-	{
+	case EPropertyKind::Int8:
 		return EMappingsTypeFlags::Int8Property;
-	}
-	else if (Flags & EClassCastFlags::Int16Property)
-	{
+	case EPropertyKind::Int16:
 		return EMappingsTypeFlags::Int16Property;
-	}
-	else if (Flags & EClassCastFlags::IntProperty)
-	{
+	case EPropertyKind::Int:
 		return EMappingsTypeFlags::IntProperty;
-	}
-	else if (Flags & EClassCastFlags::Int64Property)
-	{
+	case EPropertyKind::Int64:
 		return EMappingsTypeFlags::Int64Property;
-	}
-	else if (Flags & EClassCastFlags::FloatProperty)
-	{
+	case EPropertyKind::Float:
 		return EMappingsTypeFlags::FloatProperty;
-	}
-	else if (Flags & EClassCastFlags::DoubleProperty)
-	{
+	case EPropertyKind::Double:
 		return EMappingsTypeFlags::DoubleProperty;
-	}
-	else if ((Flags & EClassCastFlags::ObjectProperty) || (Flags & EClassCastFlags::ClassProperty))
-	{
+	case EPropertyKind::Object:
+	case EPropertyKind::Class:
 		return EMappingsTypeFlags::ObjectProperty;
-	}
-	else if (Flags & EClassCastFlags::NameProperty)
-	{
+	case EPropertyKind::Name:
 		return EMappingsTypeFlags::NameProperty;
-	}
-	else if (Flags & EClassCastFlags::StrProperty)
-	{
+	case EPropertyKind::Str:
 		return EMappingsTypeFlags::StrProperty;
-	}
-	else if (Flags & EClassCastFlags::TextProperty)
-	{
+	case EPropertyKind::Text:
 		return EMappingsTypeFlags::TextProperty;
-	}
-	else if (Flags & EClassCastFlags::BoolProperty)
-	{
+	case EPropertyKind::Bool:
 		return EMappingsTypeFlags::BoolProperty;
-	}
-	else if (Flags & EClassCastFlags::StructProperty)
-	{
+	case EPropertyKind::Struct:
 		return EMappingsTypeFlags::StructProperty;
-	}
-	else if (Flags & EClassCastFlags::ArrayProperty)
-	{
+	case EPropertyKind::Array:
 		return EMappingsTypeFlags::ArrayProperty;
-	}
-	else if (Flags & EClassCastFlags::WeakObjectProperty)
-	{
+	case EPropertyKind::WeakObject:
 		return EMappingsTypeFlags::WeakObjectProperty;
-	}
-	else if (Flags & EClassCastFlags::LazyObjectProperty)
-	{
+	case EPropertyKind::LazyObject:
 		return EMappingsTypeFlags::LazyObjectProperty;
-	}
-	else if ((Flags & EClassCastFlags::SoftObjectProperty) || (Flags & EClassCastFlags::SoftClassProperty))
-	{
+	case EPropertyKind::SoftObject:
+	case EPropertyKind::SoftClass:
 		return EMappingsTypeFlags::SoftObjectProperty;
-	}
-	else if (Flags & EClassCastFlags::MapProperty)
-	{
+	case EPropertyKind::Map:
 		return EMappingsTypeFlags::MapProperty;
-	}
-	else if (Flags & EClassCastFlags::SetProperty)
-	{
+	case EPropertyKind::Set:
 		return EMappingsTypeFlags::SetProperty;
-	}
-	else if (Flags & EClassCastFlags::EnumProperty)
-	{
+	case EPropertyKind::Enum:
 		return EMappingsTypeFlags::EnumProperty;
-	}
-	else if (Flags & EClassCastFlags::InterfaceProperty)
-	{
+	case EPropertyKind::Interface:
 		return EMappingsTypeFlags::InterfaceProperty;
-	}
-	else if (Flags & EClassCastFlags::FieldPathProperty)
-	{
+	case EPropertyKind::FieldPath:
 		return EMappingsTypeFlags::FieldPathProperty;
-	}
-	else if (Flags & EClassCastFlags::OptionalProperty)
-	{
+	case EPropertyKind::Optional:
 		return EMappingsTypeFlags::OptionalProperty;
-	}
-	else if (Flags & EClassCastFlags::MulticastDelegateProperty)
-	{
+	case EPropertyKind::MulticastDelegate:
+	case EPropertyKind::MulticastInlineDelegate:
+	case EPropertyKind::MulticastSparseDelegate:
 		return EMappingsTypeFlags::MulticastDelegateProperty;
-	}
-	else if (Flags & EClassCastFlags::DelegateProperty)
-	{
+	case EPropertyKind::Delegate:
 		return EMappingsTypeFlags::DelegateProperty;
-	}
-	else if (Flags & EClassCastFlags::Utf8StrProperty)
-	{
+	case EPropertyKind::Utf8Str:
 		return EMappingsTypeFlags::Utf8StrProperty;
-	}
-	else if (Flags & EClassCastFlags::AnsiStrProperty)
-	{
+	case EPropertyKind::AnsiStr:
 		return EMappingsTypeFlags::AnsiStrProperty;
+	default:
+		return EMappingsTypeFlags::Unknown;
 	}
-	else if (Flags & EClassCastFlags::ClassProperty)
-	{
-		return EMappingsTypeFlags::ClassProperty;
-	}
-	else if (Flags & EClassCastFlags::MulticastInlineDelegateProperty)
-	{
-		return EMappingsTypeFlags::MulticastInlineDelegateProperty;
-	}
-	else if (Flags & EClassCastFlags::SoftClassProperty)
-	{
-		return EMappingsTypeFlags::SoftClassProperty;
-	}
-	
-	return EMappingsTypeFlags::Unknown;
 }
 
 int32 MappingGenerator::AddNameToData(std::stringstream& NameTable, const std::string& Name)
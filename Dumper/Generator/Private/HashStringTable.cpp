@@ -2,76 +2,103 @@
 
 
 #pragma warning(suppress: 26495)
-HashStringTable::HashStringTable(uint32 InitialBucketSize)
+HashStringTable::HashStringTable(uint32 InitialPageSize)
+    : PageSize(InitialPageSize)
 {
-    assert((InitialBucketSize) >= 0x0 && "HashStringTable(0x0) is invalid!");
+    assert((InitialPageSize) > 0x0 && "HashStringTable(0x0) is invalid!");
 
     for (int i = 0; i < NumBuckets; i++)
-    {
-        StringBucket& CurrentBucket = Buckets[i];
-        CurrentBucket.Data = static_cast<uint8*>(malloc(InitialBucketSize));
-
-        CurrentBucket.Size = 0x0;
-        CurrentBucket.SizeMax = InitialBucketSize;
-    }
+        AddPage(Buckets[i], PageSize);
 }
 
 HashStringTable::~HashStringTable()
 {
     for (int i = 0; i < NumBuckets; i++)
     {
-        StringBucket& CurrentBucket = Buckets[i];
-
-        if (!CurrentBucket.Data)
-            continue;
+        for (StringPage& Page : Buckets[i].Pages)
+        {
+            free(Page.Data);
+            Page.Data = nullptr;
+        }
 
-        free(CurrentBucket.Data);
-        CurrentBucket.Data = nullptr;
+        Buckets[i].Pages.clear();
     }
 }
 
 
-bool HashStringTable::CanFit(const StringBucket& Bucket, int32 StrLengthBytes) const
+bool HashStringTable::CanFit(const StringPage& Page, int32 StrLengthBytes) const
 {
-    const int32 EntryLength = StringEntry::StringEntrySizeWithoutStr + StrLengthBytes;
+    const uint64 EntryLength = StringEntry::StringEntrySizeWithoutStr + StrLengthBytes;
 
-    return (Bucket.Size + EntryLength) <= Bucket.SizeMax;
+    return (Page.Size + EntryLength) <= Page.SizeMax;
 }
 
-StringEntry& HashStringTable::GetRefToEmpty(const StringBucket& Bucket)
+void HashStringTable::AddPage(StringBucket& Bucket, uint32 MinPageSize)
 {
-    return *reinterpret_cast<StringEntry*>(Bucket.Data + Bucket.Size);
+    const uint32 NewPageSize = MinPageSize > PageSize ? MinPageSize : PageSize;
+
+    uint8* NewData = static_cast<uint8*>(malloc(NewPageSize));
+
+    assert(NewData != nullptr && "Malloc failed in function 'AddPage()'.");
+
+    Bucket.Pages.push_back(StringPage{ NewData, 0x0, NewPageSize });
 }
 
-const StringEntry& HashStringTable::GetStringEntry(const StringBucket& Bucket, int32 InBucketIndex) const
+HashStringTable::StringPage& HashStringTable::GetPageForNewEntry(StringBucket& Bucket, int32 StrLengthBytes)
 {
-    return *reinterpret_cast<StringEntry*>(Bucket.Data + InBucketIndex);
+    if (!CanFit(Bucket.Pages.back(), StrLengthBytes))
+        AddPage(Bucket, StringEntry::StringEntrySizeWithoutStr + StrLengthBytes);
+
+    return Bucket.Pages.back();
 }
 
-const StringEntry& HashStringTable::GetStringEntry(int32 BucketIndex, int32 InBucketIndex) const
+void HashStringTable::GrowLookupIndex(uint64 MinNumEntries)
 {
-    assert(BucketIndex < 32 && "Bucket index out of range!");
+    uint64 NewSize = LookupIndex.empty() ? MinLookupIndexSize : LookupIndex.size();
+
+    /* Keep the load-factor at or below 50%, so probe-sequences stay short */
+    while (NewSize < (MinNumEntries * 2))
+        NewSize *= 2;
+
+    if (NewSize == LookupIndex.size())
+        return;
+
+    const uint64 NewMask = NewSize - 1;
+
+    std::vector<IndexSlot> NewLookupIndex(NewSize, IndexSlot{ 0x0, HashStringTableIndex::InvalidIndex });
 
-    const StringBucket& Bucket = Buckets[BucketIndex];
+    /* The lower bits of the hash were lost, recompute the position from the string itself */
+    for (const IndexSlot& Slot : LookupIndex)
+    {
+        if (Slot.Index == HashStringTableIndex::InvalidIndex)
+            continue;
+
+        const StringEntry& Entry = GetStringEntry(HashStringTableIndex::FromInt(Slot.Index));
+        const uint64 FullHash = FullWidthStringHash(Entry.Char, Entry.Length * (Entry.bIsWide ? sizeof(wchar_t) : sizeof(char)));
+
+        uint64 NewSlotIdx = FullHash & NewMask;
+        while (NewLookupIndex[NewSlotIdx].Index != HashStringTableIndex::InvalidIndex)
+            NewSlotIdx = (NewSlotIdx + 1) & NewMask;
 
-    assert((InBucketIndex > 0 && InBucketIndex < Bucket.Size) && "InBucketIndex was out of range!");
+        NewLookupIndex[NewSlotIdx] = Slot;
+    }
 
-    return *reinterpret_cast<StringEntry*>(Bucket.Data + InBucketIndex);
+    LookupIndex = std::move(NewLookupIndex);
 }
 
-void HashStringTable::ResizeBucket(StringBucket& Bucket)
+void HashStringTable::AddToLookupIndex(uint64 FullHash, HashStringTableIndex Index)
 {
-    int32 BucketIdx = &Bucket - Buckets;
-
-    const uint32 OldBucketSize = Bucket.Size;
-    const uint64 NewBucketSizeMax = Bucket.SizeMax * 1.5;
+    if ((NumIndexedEntries + 1) * 2 > LookupIndex.size())
+        GrowLookupIndex(NumIndexedEntries + 1);
 
-    uint8_t* NewData = static_cast<uint8_t*>(realloc(Bucket.Data, NewBucketSizeMax));
+    const uint64 Mask = LookupIndex.size() - 1;
 
-    assert(NewData != nullptr && "Realloc failed in function 'ResizeBucket()'.");
+    uint64 SlotIdx = FullHash & Mask;
+    while (LookupIndex[SlotIdx].Index != HashStringTableIndex::InvalidIndex)
+        SlotIdx = (SlotIdx + 1) & Mask;
 
-    Bucket.Data = NewData;
-    Bucket.SizeMax = NewBucketSizeMax;
+    LookupIndex[SlotIdx] = IndexSlot{ static_cast<uint32>(FullHash >> 32), static_cast<int64>(Index) };
+    NumIndexedEntries++;
 }
 
 template<typename CharType>
@@ -82,11 +109,9 @@ std::pair<HashStringTableIndex, bool> HashStringTable::AddUnchecked(const CharTy
     const int32 LengthBytes = Length * sizeof(CharType);
 
     StringBucket& Bucket = Buckets[Hash];
+    StringPage& Page = GetPageForNewEntry(Bucket, LengthBytes);
 
-    if (!CanFit(Bucket, LengthBytes))
-        ResizeBucket(Bucket);
-
-    StringEntry& NewEmptyEntry = GetRefToEmpty(Bucket);
+    StringEntry& NewEmptyEntry = *reinterpret_cast<StringEntry*>(Page.Data + Page.Size);
 
     NewEmptyEntry.Length = Length;
     NewEmptyEntry.bIsWide = std::is_same_v<CharType, wchar_t>;
@@ -104,13 +129,21 @@ std::pair<HashStringTableIndex, bool> HashStringTable::AddUnchecked(const CharTy
     HashStringTableIndex ReturnIndex;
     ReturnIndex.Unused = 0x0;
     ReturnIndex.HashIndex = Hash;
-    ReturnIndex.InBucketOffset = Bucket.Size;
+    ReturnIndex.PageIndex = Bucket.Pages.size() - 1;
+    ReturnIndex.InPageOffset = Page.Size;
 
-    Bucket.Size += NewEmptyEntry.GetLengthBytes();
+    Page.Size += NewEmptyEntry.GetLengthBytes();
 
     return { ReturnIndex, true };
 }
 
+void HashStringTable::MarkAsDuplicated(const StringEntry& Entry) const
+{
+    Entry.bIsUnique = true;
+    Entry.bIsUniqueTemp = false;
+    Entry.OptionalCollisionCount++;
+}
+
 const StringEntry& HashStringTable::operator[](HashStringTableIndex Index) const
 {
     return GetStringEntry(Index);
@@ -125,36 +158,43 @@ const HashStringTable::StringBucket& HashStringTable::GetBucket(uint32 Index) co
 
 const StringEntry& HashStringTable::GetStringEntry(HashStringTableIndex Index) const
 {
-    assert(Index.HashIndex < 32 && "Bucket index out of range!");
+    assert(Index.HashIndex < NumBuckets && "Bucket index out of range!");
 
     const StringBucket& Bucket = Buckets[Index.HashIndex];
 
-    assert((Index.InBucketOffset >= 0 && Index.InBucketOffset < (Bucket.Size)) && "InBucketIndex was out of range!");
+    assert(Index.PageIndex < Bucket.Pages.size() && "PageIndex was out of range!");
+
+    const StringPage& Page = Bucket.Pages[Index.PageIndex];
+
+    assert(Index.InPageOffset < Page.Size && "InPageOffset was out of range!");
 
-    return *reinterpret_cast<StringEntry*>(Bucket.Data + Index.InBucketOffset);
+    return *reinterpret_cast<StringEntry*>(Page.Data + Index.InPageOffset);
 }
 
 template<typename CharType>
-HashStringTableIndex HashStringTable::Find(const CharType* Str, int32 Length, uint8 Hash)
+HashStringTableIndex HashStringTable::Find(const CharType* Str, int32 Length, uint64 FullHash)
 {
     constexpr bool bIsWchar = std::is_same_v<CharType, wchar_t>;
 
-    StringBucket& Bucket = Buckets[Hash];
+    if (LookupIndex.empty())
+        return HashStringTableIndex::FromInt(-1);
+
+    const uint64 Mask = LookupIndex.size() - 1;
+    const uint32 HashTag = static_cast<uint32>(FullHash >> 32);
 
-    /* Try to find duplications withing 'checked' regions */
-    for (auto It = HashBucketIterator::begin(Bucket); It != HashBucketIterator::end(Bucket); ++It)
+    /* The index is never full, an empty slot always ends the probe-sequence */
+    for (uint64 SlotIdx = FullHash & Mask; LookupIndex[SlotIdx].Index != HashStringTableIndex::InvalidIndex; SlotIdx = (SlotIdx + 1) & Mask)
     {
-        const StringEntry& Entry = *It;
+        const IndexSlot& Slot = LookupIndex[SlotIdx];
 
-        if (Entry.Length == Length && Entry.bIsWide == bIsWchar && Strcmp(Str, Entry) == 0)
-        {
-            HashStringTableIndex Idx;
-            Idx.Unused = 0x0;
-            Idx.HashIndex = Hash;
-            Idx.InBucketOffset = It.GetInBucketIndex();
+        if (Slot.HashTag != HashTag)
+            continue;
 
+        const HashStringTableIndex Idx = HashStringTableIndex::FromInt(Slot.Index);
+        const StringEntry& Entry = GetStringEntry(Idx);
+
+        if (Entry.Length == Length && Entry.bIsWide == bIsWchar && Strcmp(Str, Entry) == 0)
             return Idx;
-        }
     }
 
     return HashStringTableIndex::FromInt(-1);
@@ -170,29 +210,27 @@ inline std::pair<HashStringTableIndex, bool> HashStringTable::FindOrAdd(const Ch
     if (!Str || Length <= 0 || Length > StringEntry::MaxStringLength)
     {
         std::cerr << std::format("Error on line {{{:d}}}: {}\n", __LINE__, !Str ? "!Str" : Length <= 0 ? "Length <= 0" : "Length > MaxStringLength") << std::endl;
-        return { HashStringTableIndex(-1), false };
+        return { HashStringTableIndex::FromInt(-1), false };
     }
 
-    uint8 Hash = SmallPearsonHash(Str);
+    const uint64 FullHash = FullWidthStringHash(Str, Length * sizeof(CharType));
 
-    HashStringTableIndex ExistingIndex = Find(Str, Length, Hash);
+    HashStringTableIndex ExistingIndex = Find(Str, Length, FullHash);
 
     if (ExistingIndex != -1)
     {
-        const StringEntry& Entry = GetStringEntry(ExistingIndex);
-
         if (bShouldMarkAsDuplicated)
-        {
-            Entry.bIsUnique = bShouldMarkAsDuplicated;
-            Entry.bIsUniqueTemp = false;
-            Entry.OptionalCollisionCount++;
-        }
+            MarkAsDuplicated(GetStringEntry(ExistingIndex));
 
         return { ExistingIndex, false };
     }
 
     // Only reached if Str wasn't found in StringTable, else entry is marked as not unique
-    return AddUnchecked(Str, Length, Hash);
+    const auto Result = AddUnchecked(Str, Length, SmallPearsonHash(Str));
+
+    AddToLookupIndex(FullHash, Result.first);
+
+    return Result;
 }
 
 /* returns pair<Index, bWasAdded> */
@@ -201,15 +239,37 @@ std::pair<HashStringTableIndex, bool> HashStringTable::FindOrAdd(const std::stri
     return FindOrAdd(String.c_str(), String.size(), bShouldMarkAsDuplicated);
 }
 
-int32 HashStringTable::GetTotalUsedSize() const
+void HashStringTable::Reserve(uint64 ExpectedBytes)
 {
-    uint64 TotalMemoryUsed = 0x0;
+    /* Strings aren't spread evenly across buckets, leave some headroom */
+    uint64 ExpectedBytesPerBucket = ((ExpectedBytes / NumBuckets) * 3) / 2;
+
+    /* A single page can't be larger than 4GB */
+    if (ExpectedBytesPerBucket > 0xFFFFFFFF)
+        ExpectedBytesPerBucket = 0xFFFFFFFF;
 
     for (int i = 0; i < NumBuckets; i++)
     {
-        const StringBucket& Bucket = Buckets[i];
+        StringBucket& Bucket = Buckets[i];
+        const StringPage& CurrentPage = Bucket.Pages.back();
+
+        if ((CurrentPage.SizeMax - CurrentPage.Size) >= ExpectedBytesPerBucket)
+            continue;
 
-        TotalMemoryUsed += Bucket.Size;
+        AddPage(Bucket, static_cast<uint32>(ExpectedBytesPerBucket));
+    }
+
+    GrowLookupIndex(NumIndexedEntries + (ExpectedBytes / ExpectedAverageEntrySize));
+}
+
+uint64 HashStringTable::GetTotalUsedSize() const
+{
+    uint64 TotalMemoryUsed = 0x0;
+
+    for (int i = 0; i < NumBuckets; i++)
+    {
+        for (const StringPage& Page : Buckets[i].Pages)
+            TotalMemoryUsed += Page.Size;
     }
 
     return TotalMemoryUsed;
@@ -224,10 +284,19 @@ void HashStringTable::DebugPrintStats() const
     {
         const StringBucket& Bucket = Buckets[i];
 
-        TotalMemoryUsed += Bucket.Size;
-        TotalMemoryAllocated += Bucket.SizeMax;
+        uint64 BucketSize = 0x0;
+        uint64 BucketSizeMax = 0x0;
+
+        for (const StringPage& Page : Bucket.Pages)
+        {
+            BucketSize += Page.Size;
+            BucketSizeMax += Page.SizeMax;
+        }
 
-        std::cerr << std::format("Bucket[{:02d}] = {{ Data = {:p}, Size = {:05X}, SizeMax = {:05X} }}\n", i, static_cast<void*>(Bucket.Data), Bucket.Size, Bucket.SizeMax);
+        TotalMemoryUsed += BucketSize;
+        TotalMemoryAllocated += BucketSizeMax;
+
+        std::cerr << std::format("Bucket[{:02d}] = {{ NumPages = {:d}, Size = {:05X}, SizeMax = {:05X} }}\n", i, Bucket.Pages.size(), BucketSize, BucketSizeMax);
     }
 
     std::cerr << std::endl;
@@ -235,7 +304,7 @@ void HashStringTable::DebugPrintStats() const
     std::cerr << std::format("TotalMemoryUsed: {:X}\n", TotalMemoryUsed);
     std::cerr << std::format("TotalMemoryAllocated: {:X}\n", TotalMemoryAllocated);
     std::cerr << std::format("Percentage of allocation in use: {:.3f}\n", static_cast<double>(TotalMemoryUsed) / TotalMemoryAllocated);
+    std::cerr << std::format("LookupIndex: {:d}/{:d} slots in use\n", NumIndexedEntries, LookupIndex.size());
 
     std::cerr << "\n" << std::endl;
-}
-
+}
\ No newline at end of file
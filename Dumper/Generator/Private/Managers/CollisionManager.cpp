@@ -86,6 +86,11 @@ uint64 KeyFunctions::GetKeyForCollisionInfo(UEStruct Super, UEProperty Member)
 	return reinterpret_cast<uint64>(Member.GetAddress());
 }
 
+uint64 KeyFunctions::GetKeyForName(FName Name)
+{
+	return (static_cast<uint64>(static_cast<uint32>(Name.GetCompIdx())) << 32) | Name.GetNumber();
+}
+
 uint64 KeyFunctions::GetKeyForCollisionInfo([[maybe_unused]] UEStruct Super, UEFunction Member)
 {
 	uint64 Key = 0x0;
@@ -234,7 +239,9 @@ void CollisionManager::AddStructToNameContainer(UEStruct Struct, bool bIsStruct)
 
 	auto AddToContainerAndTranslationMap = [&](auto Member, ECollisionType CollisionType, bool bIsStruct, UEFunction Func = nullptr) -> void
 	{
-		const uint64 Index = AddNameToContainer(StructNames, Struct, MemberNames.FindOrAdd(Member.GetValidName()), CollisionType, bIsStruct, Func);
+		auto NamePair = MemberNames.FindOrAddCached(KeyFunctions::GetKeyForName(Member.GetFName()), [&]() -> std::string { return Member.GetValidName(); });
+
+		const uint64 Index = AddNameToContainer(StructNames, Struct, std::move(NamePair), CollisionType, bIsStruct, Func);
 
 		const auto [It, bInserted] = TranslationMap.emplace(KeyFunctions::GetKeyForCollisionInfo(Struct, Member), Index);
 		
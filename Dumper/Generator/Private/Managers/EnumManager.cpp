@@ -145,13 +145,17 @@ void EnumManager::InitInternal()
 			for (int i = 0; i < NameValuePairs.size(); i++)
 			{
 				auto& [Name, Value] = NameValuePairs[i];
-					
-				std::wstring NameWitPrefix = Name.ToWString();
 
-				if (!NameWitPrefix.ends_with(L"_MAX"))
-					EnumMaxValue = max(EnumMaxValue, Value);
+				auto [NameIndex, bWasInserted] = UniqueEnumValueNames.FindOrAddCached(KeyFunctions::GetKeyForName(Name), [&]() -> std::string
+				{
+					std::wstring NameWitPrefix = Name.ToWString();
 
-				auto [NameIndex, bWasInserted] = UniqueEnumValueNames.FindOrAdd(MakeNameValid(NameWitPrefix.substr(NameWitPrefix.find_last_of(L"::") + 1)));
+					return MakeNameValid(NameWitPrefix.substr(NameWitPrefix.find_last_of(L"::") + 1));
+				});
+
+				/* The prefix was cut off, but '_MAX' is a valid suffix and remains in the name */
+				if (NameIndex == -1 || !UniqueEnumValueNames[NameIndex].GetNameView().ends_with("_MAX"))
+					EnumMaxValue = max(EnumMaxValue, Value);
 
 				EnumCollisionInfo CurrentEnumValueInfo;
 				CurrentEnumValueInfo.MemberName = NameIndex;
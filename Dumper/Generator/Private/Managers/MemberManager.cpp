@@ -95,6 +95,9 @@ void MemberManager::InitReservedNames()
 	MemberNames.AddReservedClassName("StaticName", false);
 	MemberNames.AddReservedClassName("GetDefaultObj", false);
 
+	/* Native-flag emitted into every parameter struct, read by TBatchInvoker */
+	MemberNames.AddReservedName("bIsNativeFunction");
+
 
 	/* Reserved C++ keywords, typedefs and macros */
 	MemberNames.AddReservedName("byte");
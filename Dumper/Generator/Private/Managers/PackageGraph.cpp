@@ -0,0 +1,271 @@
+#include <algorithm>
+
+#include "Managers/PackageGraph.h"
+
+
+PackageGraph PackageGraph::Build(std::vector<int32> PackageIndices, const std::vector<PackageEdge>& PackageEdges)
+{
+	PackageGraph Graph;
+
+	std::sort(PackageIndices.begin(), PackageIndices.end());
+	PackageIndices.erase(std::unique(PackageIndices.begin(), PackageIndices.end()), PackageIndices.end());
+
+	Graph.Packages = std::move(PackageIndices);
+
+	const int32 NumNodes = Graph.NumNodes();
+
+	std::vector<std::pair<NodeIndex, NodeIndex>> NodeEdges;
+	NodeEdges.reserve(PackageEdges.size());
+
+	for (const PackageEdge& Edge : PackageEdges)
+	{
+		const NodeIndex From = Graph.GetNode(Edge.FromPackage, Edge.FromLayer);
+		const NodeIndex To = Graph.GetNode(Edge.ToPackage, Edge.ToLayer);
+
+		if (From != -1 && To != -1)
+			NodeEdges.emplace_back(From, To);
+	}
+
+	/* Sorting by source first and target second groups the edges of a node and sorts them by target, duplicates are next to each other */
+	std::sort(NodeEdges.begin(), NodeEdges.end());
+	NodeEdges.erase(std::unique(NodeEdges.begin(), NodeEdges.end()), NodeEdges.end());
+
+	Graph.EdgeStarts.assign(NumNodes + 1, 0x0);
+	Graph.Edges.reserve(NodeEdges.size());
+
+	for (const auto& [From, To] : NodeEdges)
+	{
+		Graph.EdgeStarts[From + 1]++;
+		Graph.Edges.push_back(To);
+	}
+
+	for (int32 Node = 0; Node < NumNodes; Node++)
+		Graph.EdgeStarts[Node + 1] += Graph.EdgeStarts[Node];
+
+	return Graph;
+}
+
+PackageGraph::NodeIndex PackageGraph::GetNode(int32 PackageIndex, ELayer Layer) const
+{
+	auto It = std::lower_bound(Packages.begin(), Packages.end(), PackageIndex);
+
+	if (It == Packages.end() || *It != PackageIndex)
+		return -1;
+
+	return static_cast<NodeIndex>(((It - Packages.begin()) * 2) + static_cast<int32>(Layer));
+}
+
+int32 PackageGraph::FindEdge(NodeIndex From, NodeIndex To) const
+{
+	const auto Begin = Edges.begin() + EdgeStarts[From];
+	const auto End = Edges.begin() + EdgeStarts[From + 1];
+
+	auto It = std::lower_bound(Begin, End, To);
+
+	if (It == End || *It != To)
+		return -1;
+
+	return static_cast<int32>(It - Edges.begin());
+}
+
+PackageGraph::StronglyConnectedComponents PackageGraph::FindStronglyConnectedComponents() const
+{
+	const int32 NumNodes = this->NumNodes();
+
+	StronglyConnectedComponents Components;
+	Components.ComponentOfNode.assign(NumNodes, -1);
+	Components.ComponentStarts.reserve(NumNodes + 1);
+	Components.ComponentStarts.push_back(0x0);
+	Components.Nodes.reserve(NumNodes);
+
+	/* Order in which nodes were first visited, and the lowest one reachable from the subtree of a node that is still on the stack */
+	std::vector<int32> VisitIndex(NumNodes, -1);
+	std::vector<int32> LowLink(NumNodes, 0x0);
+
+	std::vector<NodeIndex> Stack;
+	std::vector<uint8> IsOnStack(NumNodes, false);
+
+	/* Replaces the recursion, the node and the position of the next edge of it to visit */
+	std::vector<std::pair<NodeIndex, int32>> CallStack;
+
+	int32 NextVisitIndex = 0x0;
+
+	auto Visit = [&](NodeIndex Node) -> void
+	{
+		VisitIndex[Node] = NextVisitIndex;
+		LowLink[Node] = NextVisitIndex;
+		NextVisitIndex++;
+
+		Stack.push_back(Node);
+		IsOnStack[Node] = true;
+
+		CallStack.emplace_back(Node, EdgeStarts[Node]);
+	};
+
+	for (NodeIndex Root = 0; Root < NumNodes; Root++)
+	{
+		if (VisitIndex[Root] != -1)
+			continue;
+
+		Visit(Root);
+
+		while (!CallStack.empty())
+		{
+			auto& [Node, NextEdge] = CallStack.back();
+
+			if (NextEdge < EdgeStarts[Node + 1])
+			{
+				const NodeIndex Dependency = Edges[NextEdge++];
+
+				if (VisitIndex[Dependency] == -1)
+				{
+					/* Invalidates 'Node' and 'NextEdge' */
+					Visit(Dependency);
+				}
+				else if (IsOnStack[Dependency] && VisitIndex[Dependency] < LowLink[Node])
+				{
+					LowLink[Node] = VisitIndex[Dependency];
+				}
+
+				continue;
+			}
+
+			const NodeIndex FinishedNode = Node;
+			CallStack.pop_back();
+
+			if (!CallStack.empty())
+			{
+				const NodeIndex Parent = CallStack.back().first;
+
+				if (LowLink[FinishedNode] < LowLink[Parent])
+					LowLink[Parent] = LowLink[FinishedNode];
+			}
+
+			if (LowLink[FinishedNode] != VisitIndex[FinishedNode])
+				continue;
+
+			/* 'FinishedNode' is the root of a component, everything above it on the stack belongs to that component */
+			const int32 Component = Components.Num();
+			const size_t ComponentStart = Components.Nodes.size();
+
+			NodeIndex Member = -1;
+
+			do
+			{
+				Member = Stack.back();
+				Stack.pop_back();
+				IsOnStack[Member] = false;
+
+				Components.ComponentOfNode[Member] = Component;
+				Components.Nodes.push_back(Member);
+			}
+			while (Member != FinishedNode);
+
+			std::sort(Components.Nodes.begin() + ComponentStart, Components.Nodes.end());
+
+			Components.ComponentStarts.push_back(static_cast<int32>(Components.Nodes.size()));
+		}
+	}
+
+	return Components;
+}
+
+std::vector<uint8> PackageGraph::FindEdgesBreakingCycles(const StronglyConnectedComponents& Components, const std::function<bool(NodeIndex From, NodeIndex To)>& ShouldRemoveMutualEdge) const
+{
+	const int32 NumNodes = this->NumNodes();
+
+	std::vector<uint8> IsEdgeRemoved(Edges.size(), false);
+
+	/* Files including each other, each pair is handled once from the node with the lower index. A file including itself is always removed. */
+	for (NodeIndex Node = 0; Node < NumNodes; Node++)
+	{
+		const int32 Component = Components.ComponentOfNode[Node];
+
+		for (int32 Edge = EdgeStarts[Node]; Edge < EdgeStarts[Node + 1]; Edge++)
+		{
+			const NodeIndex Dependency = Edges[Edge];
+
+			if (Dependency == Node)
+			{
+				IsEdgeRemoved[Edge] = true;
+				continue;
+			}
+
+			if (Dependency < Node || Components.ComponentOfNode[Dependency] != Component)
+				continue;
+
+			const int32 ReverseEdge = FindEdge(Dependency, Node);
+
+			if (ReverseEdge == -1)
+				continue;
+
+			if (ShouldRemoveMutualEdge(Node, Dependency))
+			{
+				IsEdgeRemoved[Edge] = true;
+			}
+			else
+			{
+				IsEdgeRemoved[ReverseEdge] = true;
+			}
+		}
+	}
+
+	/* Removing the back-edges of a depth-first search leaves a graph without cycles, only edges within a component can be part of a cycle */
+	enum class EVisitState : uint8
+	{
+		Unvisited,
+		OnPath,
+		Finished,
+	};
+
+	std::vector<EVisitState> States(NumNodes, EVisitState::Unvisited);
+	std::vector<std::pair<NodeIndex, int32>> CallStack;
+
+	for (int32 Component = 0; Component < Components.Num(); Component++)
+	{
+		const std::span<const NodeIndex> ComponentNodes = Components.GetNodes(Component);
+
+		/* Single nodes can only be cyclic by including themselves, which was handled above */
+		if (ComponentNodes.size() <= 0x1)
+			continue;
+
+		for (const NodeIndex Root : ComponentNodes)
+		{
+			if (States[Root] != EVisitState::Unvisited)
+				continue;
+
+			States[Root] = EVisitState::OnPath;
+			CallStack.emplace_back(Root, EdgeStarts[Root]);
+
+			while (!CallStack.empty())
+			{
+				auto& [Node, NextEdge] = CallStack.back();
+
+				if (NextEdge >= EdgeStarts[Node + 1])
+				{
+					States[Node] = EVisitState::Finished;
+					CallStack.pop_back();
+					continue;
+				}
+
+				const int32 Edge = NextEdge++;
+				const NodeIndex Dependency = Edges[Edge];
+
+				if (IsEdgeRemoved[Edge] || Components.ComponentOfNode[Dependency] != Component)
+					continue;
+
+				if (States[Dependency] == EVisitState::OnPath)
+				{
+					IsEdgeRemoved[Edge] = true;
+				}
+				else if (States[Dependency] == EVisitState::Unvisited)
+				{
+					States[Dependency] = EVisitState::OnPath;
+					CallStack.emplace_back(Dependency, EdgeStarts[Dependency]);
+				}
+			}
+		}
+	}
+
+	return IsEdgeRemoved;
+}
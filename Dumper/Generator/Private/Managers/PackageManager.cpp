@@ -291,6 +291,7 @@ void PackageManager::InitDependencies()
 				{
 					/* A package can't depend on itself, super of a structs will always be in _"structs" file, same for classes and "_classes" files */
 					RequirementInfo& ReqInfo = PackageDependencyList[SuperPackageIdx];
+					ReqInfo.PackageIdx = SuperPackageIdx;
 					BooleanOrEqual(ReqInfo.bShouldIncludeStructs, !bIsClass);
 					BooleanOrEqual(ReqInfo.bShouldIncludeClasses, bIsClass);
 				}
@@ -430,141 +431,100 @@ void PackageManager::HelperInitEnumFwdDeclarationsForPackage(int32 PackageForFwd
 	EnumsToForwardDeclare.erase(std::unique(EnumsToForwardDeclare.begin(), EnumsToForwardDeclare.end()), EnumsToForwardDeclare.end());
 }
 
-/* Safe to use StructManager, initialization is guaranteed to have been finished */
-void PackageManager::HandleCycles()
+void PackageManager::RemoveCyclicInclude(const PackageGraph& Graph, PackageGraph::NodeIndex Node, PackageGraph::NodeIndex RequiredNode)
 {
-	struct CycleInfo
-	{
-		int32 CurrentPackage;
-		int32 PreviousPacakge;
+	const int32 PackageIndex = Graph.GetPackageIndex(Node);
+	const int32 RequiredPackageIndex = Graph.GetPackageIndex(RequiredNode);
 
-		bool bAreStructsCyclic;
-		bool bAreclassesCyclic;
-	};
-
-	std::vector<CycleInfo> HandledPackages;
+	const bool bIsClass = Graph.GetLayer(Node) == PackageGraph::ELayer::Classes;
+	const bool bRequiresStructs = Graph.GetLayer(RequiredNode) == PackageGraph::ELayer::Structs;
 
+	PackageInfo& Info = PackageInfos.at(PackageIndex);
 
-	FindCycleCallbackType CleanedUpOnCycleFoundCallback = [&HandledPackages](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void
+	/* Structs from the required package used by value (as super or member) are replaced by cycle-fixup types */
+	DependencyManager::OnVisitCallbackType SetCycleCallback = [PackageIndex, RequiredPackageIndex, bIsClass](int32 Index) -> void
 	{
-		const int32 CurrentPackageIndex = NewParams.RequiredPackage;
-		const int32 PreviousPackageIndex = NewParams.PrevPackage;
-
-		/* Check if this pacakge was handled before, return if true */
-		for (const CycleInfo& Cycle : HandledPackages)
-		{
-			if (((Cycle.CurrentPackage == CurrentPackageIndex && Cycle.PreviousPacakge == PreviousPackageIndex)
-				|| (Cycle.CurrentPackage == PreviousPackageIndex && Cycle.PreviousPacakge == CurrentPackageIndex))
-				&& (Cycle.bAreStructsCyclic == bIsStruct || Cycle.bAreclassesCyclic == !bIsStruct))
-			{
-				return;
-			}
-		}
-
-		/* Current cyclic packages will be added to 'HandledPackages' later on in this function */
-
-
-		const PackageInfoHandle CurrentPackageInfo = GetInfo(CurrentPackageIndex);
-		const PackageInfoHandle PreviousPackageInfo = GetInfo(PreviousPackageIndex);
-
-		const DependencyManager& CurrentStructsOrClasses = bIsStruct ? CurrentPackageInfo.GetSortedStructs() : CurrentPackageInfo.GetSortedClasses();
-		const DependencyManager& PreviousStructsOrClasses = bIsStruct ? PreviousPackageInfo.GetSortedStructs() : PreviousPackageInfo.GetSortedClasses();
-
-
-		bool bIsMutualInclusion = false;
-
-		if (bIsStruct)
-		{
-			bIsMutualInclusion = CurrentPackageInfo.GetPackageDependencies().StructsDependencies.contains(PreviousPackageIndex) 
-				&& PreviousPackageInfo.GetPackageDependencies().StructsDependencies.contains(CurrentPackageIndex);
-		}
-		else
-		{
-			bIsMutualInclusion = CurrentPackageInfo.GetPackageDependencies().ClassesDependencies.contains(PreviousPackageIndex)
-				&& PreviousPackageInfo.GetPackageDependencies().ClassesDependencies.contains(CurrentPackageIndex);
-		}
+		HelperMarkStructDependenciesOfPackage(ObjectArray::GetByIndex<UEStruct>(Index), PackageIndex, RequiredPackageIndex, bIsClass);
+	};
 
-		/* Use the number of dependencies between the packages to decide which one to mark as cyclic */
-		if (bIsMutualInclusion)
-		{
-			/* Number of structs from PreviousPackage required by CurrentPackage */
-			int32 NumStructsRequiredByCurrent = 0x0;
+	const DependencyManager& StructsOrClasses = bIsClass ? Info.ClassesSorted : Info.StructsSorted;
+	StructsOrClasses.VisitAllNodesWithCallback(SetCycleCallback);
 
-			DependencyManager::OnVisitCallbackType CountDependenciesForCurrent = [&NumStructsRequiredByCurrent, PreviousPackageIndex, bIsStruct](int32 Index) -> void
-			{
-				NumStructsRequiredByCurrent += HelperCountStructDependenciesOfPackage(ObjectArray::GetByIndex<UEStruct>(Index), PreviousPackageIndex, !bIsStruct);
-			};
-			CurrentStructsOrClasses.VisitAllNodesWithCallback(CountDependenciesForCurrent);
+	/* Enums are declared in the "_structs.hpp" file, the ones used from it are forward declared instead */
+	if (bRequiresStructs)
+		HelperInitEnumFwdDeclarationsForPackage(PackageIndex, RequiredPackageIndex, bIsClass);
 
+	DependencyListType& Dependencies = bIsClass ? Info.PackageDependencies.ClassesDependencies : Info.PackageDependencies.StructsDependencies;
 
-			/* Number of structs from CurrentPackage required by CurrentPackage PreviousPackage */
-			int32 NumStructsRequiredByPrevious = 0x0;
+	auto It = Dependencies.find(RequiredPackageIndex);
 
-			DependencyManager::OnVisitCallbackType CountDependenciesForPrevious = [&NumStructsRequiredByPrevious, CurrentPackageIndex, bIsStruct](int32 Index) -> void
-			{
-				NumStructsRequiredByPrevious += HelperCountStructDependenciesOfPackage(ObjectArray::GetByIndex<UEStruct>(Index), CurrentPackageIndex, !bIsStruct);
-			};
-			PreviousStructsOrClasses.VisitAllNodesWithCallback(CountDependenciesForPrevious);
+	if (It == Dependencies.end())
+		return;
 
+	RequirementInfo& Requirements = It->second;
 
-			/* Which of the two cyclic packages requires less structs from the other package. */
-			const bool bCurrentHasMoreDependencies = NumStructsRequiredByCurrent > NumStructsRequiredByPrevious;
+	/* The package may still include the other file of the required package */
+	if (bRequiresStructs)
+	{
+		Requirements.bShouldIncludeStructs = false;
+	}
+	else
+	{
+		Requirements.bShouldIncludeClasses = false;
+	}
 
-			const int32 PackageIndexWithLeastDependencies = bCurrentHasMoreDependencies && bIsStruct ? PreviousPackageIndex : CurrentPackageIndex;
-			const int32 PackageIndexToMarkCyclicWith = bCurrentHasMoreDependencies && bIsStruct ? CurrentPackageIndex : PreviousPackageIndex;
+	if (!Requirements.bShouldIncludeStructs && !Requirements.bShouldIncludeClasses)
+		Dependencies.erase(It);
+}
 
+/* Safe to use StructManager, initialization is guaranteed to have been finished */
+void PackageManager::HandleCycles()
+{
+	/*
+	* Every cycle of includes lies within one strongly-connected component of the include-graph, all of them are found in a single pass. Within a component
+	* the includes to remove are chosen such that the remaining includes don't form a cycle anymore.
+	*/
+	const PackageGraph Graph = BuildPackageGraph();
+	const PackageGraph::StronglyConnectedComponents Components = Graph.FindStronglyConnectedComponents();
 
-			/* Add package to HandledPackages */
-			HandledPackages.push_back({ PackageIndexWithLeastDependencies, PackageIndexToMarkCyclicWith, bIsStruct, !bIsStruct });
+	/* Number of structs of the file 'Node' requires from the file 'RequiredNode' by value, these need cycle-fixups if the include is removed */
+	auto CountStructsRequiredByValue = [&Graph](PackageGraph::NodeIndex Node, PackageGraph::NodeIndex RequiredNode) -> int32
+	{
+		const PackageInfo& Info = PackageInfos.at(Graph.GetPackageIndex(Node));
 
+		const int32 RequiredPackageIndex = Graph.GetPackageIndex(RequiredNode);
+		const bool bIsClass = Graph.GetLayer(Node) == PackageGraph::ELayer::Classes;
 
-			DependencyManager::OnVisitCallbackType SetCycleCallback = [PackageIndexWithLeastDependencies, PackageIndexToMarkCyclicWith, bIsStruct](int32 Index) -> void
-			{
-				HelperMarkStructDependenciesOfPackage(ObjectArray::GetByIndex<UEStruct>(Index), PackageIndexToMarkCyclicWith, PackageIndexWithLeastDependencies, !bIsStruct);
-			};
+		int32 NumStructsRequired = 0x0;
 
-			PreviousStructsOrClasses.VisitAllNodesWithCallback(SetCycleCallback);
-		}
-		else /* Just mark structs|classes from the previous package as cyclic */
+		DependencyManager::OnVisitCallbackType CountDependencies = [&NumStructsRequired, RequiredPackageIndex, bIsClass](int32 Index) -> void
 		{
-			HandledPackages.push_back({ PreviousPackageIndex, CurrentPackageIndex, bIsStruct, !bIsStruct });
+			NumStructsRequired += HelperCountStructDependenciesOfPackage(ObjectArray::GetByIndex<UEStruct>(Index), RequiredPackageIndex, bIsClass);
+		};
 
-			DependencyManager::OnVisitCallbackType SetCycleCallback = [PreviousPackageIndex, CurrentPackageIndex, bIsStruct](int32 Index) -> void
-			{
-				HelperMarkStructDependenciesOfPackage(ObjectArray::GetByIndex<UEStruct>(Index), PreviousPackageIndex, CurrentPackageIndex, !bIsStruct);
-			};
+		const DependencyManager& StructsOrClasses = bIsClass ? Info.ClassesSorted : Info.StructsSorted;
+		StructsOrClasses.VisitAllNodesWithCallback(CountDependencies);
 
-			PreviousStructsOrClasses.VisitAllNodesWithCallback(SetCycleCallback);
-		}
+		return NumStructsRequired;
 	};
 
-	FindCycle(CleanedUpOnCycleFoundCallback);
-
-	/* Actually remove the cycle form our dependency-graph. Couldn't be done before as it would've invalidated the iterator */
-	for (const CycleInfo& Cycle : HandledPackages)
+	/* Of two files including each other, remove the include from the one requiring less of the other one */
+	auto ShouldRemoveMutualInclude = [&CountStructsRequiredByValue](PackageGraph::NodeIndex Node, PackageGraph::NodeIndex RequiredNode) -> bool
 	{
-		const PackageInfoHandle CurrentPackageInfo = GetInfo(Cycle.CurrentPackage);
-		const PackageInfoHandle PreviousPackageInfo = GetInfo(Cycle.PreviousPacakge);
-
-		/* Add enum forward declarations to the package from which we remove the dependency, as enums are not considered by those dependencies */
-		HelperInitEnumFwdDeclarationsForPackage(Cycle.CurrentPackage, Cycle.PreviousPacakge, Cycle.bAreStructsCyclic);
+		return CountStructsRequiredByValue(Node, RequiredNode) <= CountStructsRequiredByValue(RequiredNode, Node);
+	};
 
-		if (Cycle.bAreStructsCyclic)
-		{
-			CurrentPackageInfo.ErasePackageDependencyFromStructs(Cycle.PreviousPacakge);
-			continue;
-		}
+	const std::vector<uint8> IsIncludeRemoved = Graph.FindEdgesBreakingCycles(Components, ShouldRemoveMutualInclude);
 
-		const RequirementInfo& CurrentRequirements = CurrentPackageInfo.GetPackageDependencies().ClassesDependencies.at(Cycle.CurrentPackage);
+	/* The graph isn't modified, the includes are removed from the packages' dependency-lists */
+	for (PackageGraph::NodeIndex Node = 0; Node < Graph.NumNodes(); Node++)
+	{
+		const std::span<const PackageGraph::NodeIndex> RequiredNodes = Graph.GetDependencies(Node);
 
-		/* Mark classes as 'do not include' when this package is cyclic but can still require _structs.hpp */
-		if (CurrentRequirements.bShouldIncludeStructs)
-		{
-			const_cast<RequirementInfo&>(CurrentRequirements).bShouldIncludeClasses = false;
-		}
-		else
+		for (int32 i = 0; i < RequiredNodes.size(); i++)
 		{
-			CurrentPackageInfo.ErasePackageDependencyFromClasses(Cycle.PreviousPacakge);
+			if (IsIncludeRemoved[Graph.GetFirstEdge(Node) + i])
+				RemoveCyclicInclude(Graph, Node, RequiredNodes[i]);
 		}
 	}
 }
@@ -594,148 +554,43 @@ void PackageManager::PostInit()
 	HandleCycles();
 }
 
-void PackageManager::IterateSingleDependencyImplementation(SingleDependencyIterationParamsInternal& Params, bool bCheckForCycle)
+PackageGraph PackageManager::BuildPackageGraph()
 {
-	if (!Params.bShouldHandlePackage)
-		return;
+	std::vector<int32> PackageIndices;
+	PackageIndices.reserve(PackageInfos.size());
 
-	const bool bIsIncluded = Params.IterationHitCounterRef >= CurrentIterationHitCount;
+	std::vector<PackageGraph::PackageEdge> Includes;
 
-	if (!bIsIncluded)
+	auto AddIncludes = [&Includes](int32 PackageIndex, const DependencyListType& Dependencies, PackageGraph::ELayer Layer) -> void
 	{
-		Params.IterationHitCounterRef = CurrentIterationHitCount;
-
-		IncludeData& Include = Params.VisitedNodes[Params.CurrentIndex];
-		Include.bIncludedStructs = (Include.bIncludedStructs || Params.bIsStruct);
-		Include.bIncludedClasses = (Include.bIncludedClasses || !Params.bIsStruct);
-
-		for (auto& [Index, Requirements] : Params.Dependencies)
+		for (const auto& [RequiredPackageIndex, Requirements] : Dependencies)
 		{
-			Params.NewParams.bWasPrevNodeStructs = Params.bIsStruct;
-			Params.NewParams.bRequiresClasses = Requirements.bShouldIncludeClasses;
-			Params.NewParams.bRequiresStructs = Requirements.bShouldIncludeStructs;
-			Params.NewParams.RequiredPackage = Requirements.PackageIdx;
-
-			/* Iterate dependencies recursively */
-			IterateDependenciesImplementation(Params.NewParams, Params.CallbackForEachPackage, Params.OnFoundCycle, bCheckForCycle);
-		}
+			if (Requirements.bShouldIncludeStructs)
+				Includes.push_back({ PackageIndex, RequiredPackageIndex, Layer, PackageGraph::ELayer::Structs });
 
-		Params.VisitedNodes.erase(Params.CurrentIndex);
-
-		// PERFORM ACTION
-		Params.CallbackForEachPackage(Params.NewParams, Params.OldParams, Params.bIsStruct);
-		return;
-	}
-
-	if (bCheckForCycle)
-	{
-		auto It = Params.VisitedNodes.find(Params.CurrentIndex);
-		if (It != Params.VisitedNodes.end())
-		{
-			if ((It->second.bIncludedStructs && Params.bIsStruct) || (It->second.bIncludedClasses && !Params.bIsStruct))
-				Params.OnFoundCycle(Params.NewParams, Params.OldParams, Params.bIsStruct);
+			if (Requirements.bShouldIncludeClasses)
+				Includes.push_back({ PackageIndex, RequiredPackageIndex, Layer, PackageGraph::ELayer::Classes });
 		}
-	}
-}
-
-void PackageManager::IterateDependenciesImplementation(const PackageManagerIterationParams& Params, const IteratePackagesCallbackType& CallbackForEachPackage, const FindCycleCallbackType& OnFoundCycle, bool bCheckForCycle)
-{
-	PackageManagerIterationParams NewParams = {
-		.PrevPackage = Params.RequiredPackage,
-
-		.VisitedNodes = Params.VisitedNodes,
-	};
-
-	DependencyInfo& Dependencies = PackageInfos.at(Params.RequiredPackage).PackageDependencies;
-
-	SingleDependencyIterationParamsInternal StructsParams{
-		.CallbackForEachPackage = CallbackForEachPackage,
-		.OnFoundCycle = OnFoundCycle,
-
-		.NewParams = NewParams,
-		.OldParams = Params,
-		.Dependencies = Dependencies.StructsDependencies,
-		.VisitedNodes = Params.VisitedNodes,
-
-		.CurrentIndex = Params.RequiredPackage,
-		.PrevIndex = Params.PrevPackage,
-		.IterationHitCounterRef = Dependencies.StructsIterationHitCount,
-
-		.bShouldHandlePackage = Params.bRequiresStructs,
-		.bIsStruct = true,
-	};
-
-	SingleDependencyIterationParamsInternal ClassesParams{
-		.CallbackForEachPackage = CallbackForEachPackage,
-		.OnFoundCycle = OnFoundCycle,
-
-		.NewParams = NewParams,
-		.OldParams = Params,
-		.Dependencies = Dependencies.ClassesDependencies,
-		.VisitedNodes = Params.VisitedNodes,
-
-		.CurrentIndex = Params.RequiredPackage,
-		.PrevIndex = Params.PrevPackage,
-		.IterationHitCounterRef = Dependencies.ClassesIterationHitCount,
-
-		.bShouldHandlePackage = Params.bRequiresClasses,
-		.bIsStruct = false,
-	};
-
-	IterateSingleDependencyImplementation(StructsParams, bCheckForCycle);
-	IterateSingleDependencyImplementation(ClassesParams, bCheckForCycle);
-}
-
-void PackageManager::IterateDependencies(const IteratePackagesCallbackType& CallbackForEachPackage)
-{
-	VisitedNodeContainerType VisitedNodes;
-
-	PackageManagerIterationParams Params = {
-		.PrevPackage = -1,
-
-		.VisitedNodes = VisitedNodes,
 	};
 
-	FindCycleCallbackType OnCycleFoundCallback = [](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void { };
-
-	/* Increment hit counter for new iteration-cycle */
-	CurrentIterationHitCount++;
-
 	for (const auto& [PackageIndex, Info] : PackageInfos)
 	{
-		Params.RequiredPackage = PackageIndex;
-		Params.bWasPrevNodeStructs = true;
-		Params.bRequiresClasses = true;
-		Params.bRequiresStructs = true;
-		Params.VisitedNodes.clear();
+		PackageIndices.push_back(PackageIndex);
 
-		IterateDependenciesImplementation(Params, CallbackForEachPackage, OnCycleFoundCallback, false);
+		AddIncludes(PackageIndex, Info.PackageDependencies.StructsDependencies, PackageGraph::ELayer::Structs);
+		AddIncludes(PackageIndex, Info.PackageDependencies.ClassesDependencies, PackageGraph::ELayer::Classes);
 	}
+
+	return PackageGraph::Build(std::move(PackageIndices), Includes);
 }
 
-void PackageManager::FindCycle(const FindCycleCallbackType& OnFoundCycle)
+void PackageManager::IterateDependencies(const IteratePackagesCallbackType& CallbackForEachPackage)
 {
-	VisitedNodeContainerType VisitedNodes;
-
-	PackageManagerIterationParams Params = {
-		.PrevPackage = -1,
-
-		.VisitedNodes = VisitedNodes,
-	};
-
-	FindCycleCallbackType CallbackForEachPackage = [](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void {};
-
-	/* Increment hit counter for new iteration-cycle */
-	CurrentIterationHitCount++;
+	const PackageGraph Graph = BuildPackageGraph();
 
-	for (const auto& [PackageIndex, Info] : PackageInfos)
-	{
-		Params.RequiredPackage = PackageIndex;
-		Params.bWasPrevNodeStructs = true;
-		Params.bRequiresClasses = true;
-		Params.bRequiresStructs = true;
-		Params.VisitedNodes.clear();
+	/* Components come after all components they include, once the cycles were removed every component is a single file */
+	const PackageGraph::StronglyConnectedComponents Components = Graph.FindStronglyConnectedComponents();
 
-		IterateDependenciesImplementation(Params, CallbackForEachPackage, OnFoundCycle, true);
-	}
+	for (const PackageGraph::NodeIndex Node : Components.Nodes)
+		CallbackForEachPackage(Graph.GetPackageIndex(Node), Graph.GetLayer(Node) == PackageGraph::ELayer::Structs);
 }
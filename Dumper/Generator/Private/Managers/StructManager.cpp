@@ -1,5 +1,6 @@
 #include "Unreal/ObjectArray.h"
 #include "Managers/StructManager.h"
+#include "Managers/CollisionManager.h"
 
 StructInfoHandle::StructInfoHandle(const StructInfo& InInfo)
 	: Info(&InInfo)
@@ -76,13 +77,21 @@ void StructManager::InitAlignmentsAndNames()
 		// Add name to override info
 		StructInfo& NewOrExistingInfo = StructInfoOverrides[ObjAsStruct.GetIndex()];
 
-		std::string CppName = ObjAsStruct.GetCppName();
+		/* The name of a function only depends on its FName, many functions share a name (eg. overrides), so only build it once */
+		if (ObjAsStruct.IsA(EClassCastFlags::Function))
+		{
+			NewOrExistingInfo.Name = UniqueNameTable.FindOrAddCached(KeyFunctions::GetKeyForName(ObjAsStruct.GetFName()), [&]() -> std::string { return ObjAsStruct.GetCppName(); }, false).first;
+		}
+		else
+		{
+			std::string CppName = ObjAsStruct.GetCppName();
 
-		// Hardcoded fix for two 'UOnlineEngineInterfaceImpl' classes in the same package. Check will only match one of them.
-		if (ObjAsStruct == OnlineEngineInterfaceImplClass) [[unlikely]]
-			CppName += '2';
+			// Hardcoded fix for two 'UOnlineEngineInterfaceImpl' classes in the same package. Check will only match one of them.
+			if (ObjAsStruct == OnlineEngineInterfaceImplClass) [[unlikely]]
+				CppName += '2';
 
-		NewOrExistingInfo.Name = UniqueNameTable.FindOrAdd(CppName, !ObjAsStruct.IsA(EClassCastFlags::Function)).first;
+			NewOrExistingInfo.Name = UniqueNameTable.FindOrAdd(CppName, true).first;
+		}
 
 		// Interfaces inherit from UObject by default, but as a workaround to no virtual-inheritance we make them empty
 		if (ObjAsStruct.HasType(InterfaceClass))
@@ -253,6 +262,9 @@ void StructManager::Init()
 
 	StructInfoOverrides.reserve(0x2000);
 
+	/* Rough estimate of the total size of all unique struct-names, avoids adding pages to the string-table during init */
+	UniqueNameTable.Reserve(ObjectArray::Num() * 0x4);
+
 	InitAlignmentsAndNames();
 	InitSizesAndIsFinal();
 
@@ -47,6 +47,15 @@ private:
         std::vector<ParamInfo> UnrealFuncParams; // for unreal-functions only
     };
 
+    struct NameTableEntry
+    {
+        int32 ComparisonIndex;
+        uint32 Number;
+        int32 DisplayIndex;
+
+        bool operator==(const NameTableEntry& Other) const = default;
+    };
+
     enum class EFileType
     {
         Classes,
@@ -66,6 +75,8 @@ private:
         SdkHpp,
 
         DebugAssertions,
+
+        NameTable,
     };
 
 private:
@@ -83,6 +94,9 @@ public:
 private:
     static inline std::vector<PredefinedStruct> PredefinedStructs;
 
+    /* Classes written to NameTable.hpp, by their identifier in the table */
+    static inline std::unordered_map<std::string, NameTableEntry> ClassNameTable;
+
 private:
     static std::string MakeMemberString(const std::string& Type, const std::string& Name, std::string&& Comment);
     static std::string MakeMemberStringWithoutName(const std::string& Type);
@@ -112,6 +126,10 @@ private: /* utility functions */
     static std::string GetEnumPrefixedName(const EnumWrapper& Enum);
     static std::string GetEnumUnderlayingType(const EnumWrapper& Enm);
 
+    static std::string GetFunctionTableName(const std::string& StructName);
+    static std::string GetNameTableIdentifier(const FName Name);
+    static std::string GetNameTableClassEntry(const StructWrapper& Struct);
+
     static std::string GetAssertionMacroString(const std::string& PrefixedStructUniqueName);
 
     static std::string GetCycleFixupType(const StructWrapper& Struct, bool bIsForInheritance);
@@ -125,6 +143,7 @@ private:
     static void GenerateNameCollisionsInl(StreamType& NameCollisionsFile);
     static void GeneratePropertyFixupFile(StreamType& PropertyFixup);
     static void GenerateDebugAssertions(StreamType& AssertionStream);
+    static void GenerateNameTable(StreamType& NameTableFile);
     static void WriteFileHead(StreamType& File, PackageInfoHandle Package, EFileType Type, const std::string& CustomFileComment = "", const std::string& CustomIncludes = "");
     static void WriteFileEnd(StreamType& File, EFileType Type);
 
@@ -6,6 +6,8 @@
 #include "Managers/DependencyManager.h"
 #include "Managers/MemberManager.h"
 #include "HashStringTable.h"
+#include "TaskGraph.h"
+#include "Profiler/Profiler.h"
 
 
 namespace fs = std::filesystem;
@@ -53,34 +55,19 @@ public:
 private:
     static bool SetupDumperFolder();
 
+    /* Size of all files in 'Folder' and its subfolders, for Profiler::ECounter::BytesWritten */
+    static uint64 GetFolderSize(const fs::path& Folder);
+
     static bool SetupFolders(std::string& FolderName, fs::path& OutFolder);
     static bool SetupFolders(std::string& FolderName, fs::path& OutFolder, std::string& SubfolderName, fs::path& OutSubFolder);
 
-public:
-    template<GeneratorImplementation GeneratorType>
-    static void Generate() 
-    { 
-        if (DumperFolder.empty())
-        {
-            if (!SetupDumperFolder())
-                return;
-
-            if (!bDumpedGObjects)
-            {
-                bDumpedGObjects = true;
-                ObjectArray::DumpObjects(DumperFolder);
-
-                if (Settings::Internal::bUseFProperty)
-                    ObjectArray::DumpObjectsWithProperties(DumperFolder);
-            }
-
-            if (!bDumepdEditorOnlyMetadata)
-            {
-                bDumepdEditorOnlyMetadata = true;
-                DumpEditorOnlyMetadata(DumperFolder);
-            }
-        }
+    /* Creates the dumper-folder and dumps GObjects, once. Must have finished before any generator runs. */
+    static bool SetupGeneration();
 
+    /* Runs a single generator on the calling thread, the predefined members of 'GeneratorType' are bound to this thread while it runs */
+    template<GeneratorImplementation GeneratorType>
+    static void RunGenerator()
+    {
         if (!SetupFolders(GeneratorType::MainFolderName, GeneratorType::MainFolder, GeneratorType::SubfolderName, GeneratorType::Subfolder))
             return;
 
@@ -89,6 +76,48 @@ public:
 
         MemberManager::SetPredefinedMemberLookupPtr(&GeneratorType::PredefinedMembers);
 
-        GeneratorType::Generate();
+        {
+            Profiler::ScopedTimer Timer("Generate", GeneratorType::MainFolderName);
+            GeneratorType::Generate();
+        }
+
+        MemberManager::SetPredefinedMemberLookupPtr(nullptr);
+
+        Profiler::Increment(Profiler::ECounter::BytesWritten, GetFolderSize(GeneratorType::MainFolder));
+    }
+
+public:
+    template<GeneratorImplementation GeneratorType>
+    static void Generate() 
+    { 
+        if (!SetupGeneration())
+            return;
+
+        RunGenerator<GeneratorType>();
     };
+
+    /*
+    * Runs all generators at the same time, each one on its own thread. Total time is roughly the time of the slowest generator.
+    * 
+    * The managers are read-only once InitInternal() has finished. Each generator only writes to its own static members and output-folder.
+    */
+    template<GeneratorImplementation... GeneratorTypes>
+    static void GenerateConcurrently()
+    {
+        if (!SetupGeneration())
+            return;
+
+        TaskGraph GenerateGraph;
+
+        (GenerateGraph.AddTask(GeneratorTypes::MainFolderName, &RunGenerator<GeneratorTypes>), ...);
+
+        GenerateGraph.Run();
+
+        GenerateGraph.PrintTimings("Generate");
+    }
+
+    static inline const fs::path& GetDumperFolder()
+    {
+        return DumperFolder;
+    }
 };
@@ -3,6 +3,8 @@
 #include <cassert>
 #include <format>
 #include <iostream>
+#include <vector>
+#include <unordered_map>
 
 #include "Unreal/Enums.h"
 
@@ -34,6 +36,42 @@ inline uint8 SmallPearsonHash(const char* StringToHash)
     return (Hash & HashMask);
 }
 
+/* 64-bit hash over the raw bytes of a string, reads 8 bytes at a time. Used for the lookup-index of HashStringTable. */
+inline uint64 FullWidthStringHash(const void* Data, int32 LengthBytes)
+{
+    constexpr uint64 Multiplier = 0x9E3779B97F4A7C15;
+
+    const uint8* Bytes = static_cast<const uint8*>(Data);
+    uint64 Hash = 0xA0761D6478BD642F ^ (static_cast<uint64>(LengthBytes) * Multiplier);
+
+    for (; LengthBytes >= 8; LengthBytes -= 8, Bytes += 8)
+    {
+        uint64 Word;
+        memcpy(&Word, Bytes, sizeof(Word));
+
+        Hash = (Hash ^ Word) * Multiplier;
+        Hash ^= Hash >> 32;
+    }
+
+    if (LengthBytes > 0)
+    {
+        uint64 Word = 0x0;
+        memcpy(&Word, Bytes, LengthBytes);
+
+        Hash = (Hash ^ Word) * Multiplier;
+        Hash ^= Hash >> 32;
+    }
+
+    /* Final avalanche, taken from MurmurHash3's fmix64 */
+    Hash ^= Hash >> 33;
+    Hash *= 0xFF51AFD7ED558CCD;
+    Hash ^= Hash >> 33;
+    Hash *= 0xC4CEB9FE1A85EC53;
+    Hash ^= Hash >> 33;
+
+    return Hash;
+}
+
 /* Used to limit access to StringEntry::OptionalCollisionCount to authorized (friend) classes only */
 struct AccessLimitedCollisionCount
 {
@@ -61,16 +99,16 @@ private:
     friend int32 Strcmp(const CharType* String, const StringEntry& Entry);
 
 public:
-    static constexpr int32 MaxStringLength = 1 << 11;
+    static constexpr int32 MaxStringLength = 1 << 20;
 
-    static constexpr int32 StringEntrySizeWithoutStr = 0x3;
+    static constexpr int32 StringEntrySizeWithoutStr = 0x5;
 
 private:
     // Length of object name
-    uint16 Length : 11;
+    uint32 Length : 27;
 
     // PearsonHash reduced to 5 bits --- only computed if string was added when StringTable::CurrentMode == EDuplicationCheckingMode::Check
-    uint16 Hash : 5;
+    uint32 Hash : 5;
 
     // If this string uses char or wchar_t
     uint8 bIsWide : 1;
@@ -123,29 +161,30 @@ inline int32 Strcmp(const CharType* String, const StringEntry& Entry)
 struct HashStringTableIndex
 {
 public:
-    static constexpr int32 InvalidIndex = -1;
+    static constexpr int64 InvalidIndex = -1;
 
 public:
-    uint32 Unused : 1;
-    uint32 HashIndex : 5;
-    uint32 InBucketOffset : 26;
+    uint64 Unused : 1;
+    uint64 HashIndex : 5;
+    uint64 PageIndex : 26;
+    uint64 InPageOffset : 32;
 
 public:
-    inline HashStringTableIndex& operator=(uint32 Value)
+    inline HashStringTableIndex& operator=(uint64 Value)
     {
-        *reinterpret_cast<uint32*>(this) = Value;
+        *reinterpret_cast<uint64*>(this) = Value;
 
         return *this;
     }
 
-    static inline HashStringTableIndex FromInt(uint32 Idx)
+    static inline HashStringTableIndex FromInt(int64 Idx)
     {
         return *reinterpret_cast<HashStringTableIndex*>(&Idx);
     }
 
-    inline operator int32() const
+    inline operator int64() const
     {
-        return *reinterpret_cast<const int32*>(this);
+        return *reinterpret_cast<const int64*>(this);
     }
 
     explicit inline operator bool() const
@@ -153,11 +192,14 @@ public:
         return *this != InvalidIndex;
     }
 
-    inline bool operator==(HashStringTableIndex Other) const { return static_cast<uint32>(*this) == static_cast<uint32>(Other); }
-    inline bool operator!=(HashStringTableIndex Other) const { return static_cast<uint32>(*this) != static_cast<uint32>(Other); }
+    inline bool operator==(HashStringTableIndex Other) const { return static_cast<int64>(*this) == static_cast<int64>(Other); }
+    inline bool operator!=(HashStringTableIndex Other) const { return static_cast<int64>(*this) != static_cast<int64>(Other); }
+
+    inline bool operator==(int64 Other) const { return static_cast<int64>(*this) == Other; }
+    inline bool operator!=(int64 Other) const { return static_cast<int64>(*this) != Other; }
 
-    inline bool operator==(int32 Other) const { return static_cast<int32>(*this) == Other; }
-    inline bool operator!=(int32 Other) const { return static_cast<int32>(*this) != Other; }
+    inline bool operator==(int32 Other) const { return static_cast<int64>(*this) == Other; }
+    inline bool operator!=(int32 Other) const { return static_cast<int64>(*this) != Other; }
 };
 
 class HashStringTable
@@ -166,23 +208,49 @@ private:
     static constexpr int64 NumHashBits = 5;
     static constexpr int64 NumBuckets = 1 << NumHashBits;
 
-    /* Checked, Unchecked */
-    static constexpr int64 NumSectionsPerBucket = 2;
-
 private:
-    struct StringBucket
+    /* Fixed block of memory holding StringEntries back-to-back. Pages are never moved or resized once allocated. */
+    struct StringPage
     {
-        // One allocated block, split in two sections, checked and unchecked
         uint8* Data;
         uint32 Size;
         uint32 SizeMax;
     };
 
+    struct StringBucket
+    {
+        std::vector<StringPage> Pages;
+    };
+
+    /* Slot of the lookup-index, refers to an entry inside of one of the buckets */
+    struct IndexSlot
+    {
+        // Upper 32 bits of the full-width hash, the lower bits are implied by the position of the slot
+        uint32 HashTag;
+        int64 Index;
+    };
+
+private:
+    static constexpr uint64 MinLookupIndexSize = 0x400;
+
+    /* Rough average size of an entry, used to size the lookup-index in Reserve() */
+    static constexpr uint64 ExpectedAverageEntrySize = StringEntry::StringEntrySizeWithoutStr + 0x10;
+
 private:
     StringBucket Buckets[NumBuckets];
 
+    /* Size of newly allocated pages, larger strings get a page of their own */
+    uint32 PageSize;
+
+    /* Open-addressing index (linear probing) over the entries of all buckets. The size is always a power of two. */
+    std::vector<IndexSlot> LookupIndex;
+    uint64 NumIndexedEntries = 0x0;
+
+    /* Index of the string that was added for an external key (eg. an FName), see FindOrAddCached() */
+    std::unordered_map<uint64, HashStringTableIndex> KeyedIndexCache;
+
 public:
-    HashStringTable(uint32 InitialBucketSize = 0x5000);
+    HashStringTable(uint32 InitialPageSize = 0x5000);
     ~HashStringTable();
 
 public:
@@ -190,32 +258,48 @@ public:
     {
     private:
         const StringBucket* IteratedBucket;
-        uint32 InBucketIndex;
+        uint32 PageIndex;
+        uint32 InPageOffset;
 
     public:
-        HashBucketIterator(const StringBucket& Bucket, uint32 InBucketStartPos = 0)
+        HashBucketIterator(const StringBucket& Bucket, uint32 PageStartIndex = 0, uint32 InPageStartPos = 0)
             : IteratedBucket(&Bucket)
-            , InBucketIndex(InBucketStartPos)
+            , PageIndex(PageStartIndex)
+            , InPageOffset(InPageStartPos)
         {
+            SkipFinishedPages();
+        }
+
+    private:
+        inline void SkipFinishedPages()
+        {
+            while (PageIndex < IteratedBucket->Pages.size() && InPageOffset >= IteratedBucket->Pages[PageIndex].Size)
+            {
+                PageIndex++;
+                InPageOffset = 0;
+            }
         }
 
     public:
-        static inline HashBucketIterator begin(const StringBucket& Bucket) { return HashBucketIterator(Bucket, 0); }
-        static inline HashBucketIterator end(const StringBucket& Bucket) { return HashBucketIterator(Bucket, Bucket.Size); }
+        static inline HashBucketIterator begin(const StringBucket& Bucket) { return HashBucketIterator(Bucket, 0, 0); }
+        static inline HashBucketIterator end(const StringBucket& Bucket) { return HashBucketIterator(Bucket, static_cast<uint32>(Bucket.Pages.size()), 0); }
 
     public:
-        inline uint32 GetInBucketIndex() const { return InBucketIndex; }
-        inline const StringEntry& GetStringEntry() const { return *reinterpret_cast<StringEntry*>(IteratedBucket->Data + InBucketIndex); }
+        inline uint32 GetPageIndex() const { return PageIndex; }
+        inline uint32 GetInPageOffset() const { return InPageOffset; }
+        inline const StringEntry& GetStringEntry() const { return *reinterpret_cast<StringEntry*>(IteratedBucket->Pages[PageIndex].Data + InPageOffset); }
 
     public:
-        inline bool operator==(const HashBucketIterator& Other) const { return InBucketIndex == Other.InBucketIndex; }
-        inline bool operator!=(const HashBucketIterator& Other) const { return InBucketIndex != Other.InBucketIndex; }
+        inline bool operator==(const HashBucketIterator& Other) const { return PageIndex == Other.PageIndex && InPageOffset == Other.InPageOffset; }
+        inline bool operator!=(const HashBucketIterator& Other) const { return PageIndex != Other.PageIndex || InPageOffset != Other.InPageOffset; }
 
         inline const StringEntry& operator*() const { return GetStringEntry(); }
 
         inline HashBucketIterator& operator++()
         {
-            InBucketIndex += GetStringEntry().GetLengthBytes();
+            InPageOffset += GetStringEntry().GetLengthBytes();
+
+            SkipFinishedPages();
 
             return *this;
         }
@@ -229,9 +313,9 @@ public:
         uint32 BucketIdx;
 
     public:
-        HashStringTableIterator(const HashStringTable& Table, uint32 BucketStartPos = 0, uint32 InBucketStartPos = 0)
+        HashStringTableIterator(const HashStringTable& Table, uint32 BucketStartPos = 0)
             : IteratedTable(Table)
-            , CurrentBucketIterator(Table.Buckets[BucketStartPos], InBucketStartPos)
+            , CurrentBucketIterator(HashBucketIterator::begin(Table.Buckets[BucketStartPos]))
             , BucketIdx(BucketStartPos)
         {
             while (CurrentBucketIterator == HashBucketIterator::end(IteratedTable.Buckets[BucketIdx]) && (++BucketIdx < NumBuckets))
@@ -248,7 +332,8 @@ public:
 
     public:
         inline uint32 GetBucketIndex() const { return BucketIdx; }
-        inline uint32 GetInBucketIndex() const { return CurrentBucketIterator.GetInBucketIndex(); }
+        inline uint32 GetPageIndex() const { return CurrentBucketIterator.GetPageIndex(); }
+        inline uint32 GetInPageOffset() const { return CurrentBucketIterator.GetInPageOffset(); }
 
     public:
         inline bool operator==(const HashStringTableIterator& Other) const { return BucketIdx == Other.BucketIdx && CurrentBucketIterator == Other.CurrentBucketIterator; }
@@ -272,17 +357,22 @@ public:
     inline HashStringTableIterator end()   const { return HashStringTableIterator(*this, HashBucketIterator::end(Buckets[NumBuckets - 1])); }
 
 private:
-    bool CanFit(const StringBucket& Bucket, int32 StrLengthBytes) const;
+    bool CanFit(const StringPage& Page, int32 StrLengthBytes) const;
+
+    /* Returns the page new entries are added to, allocating a new page if the current one can't fit 'StrLengthBytes' */
+    StringPage& GetPageForNewEntry(StringBucket& Bucket, int32 StrLengthBytes);
 
-    StringEntry& GetRefToEmpty(const StringBucket& Bucket);
-    const StringEntry& GetStringEntry(const StringBucket& Bucket, int32 InBucketIndex) const;
-    const StringEntry& GetStringEntry(int32 BucketIndex, int32 InBucketIndex) const;
+    void AddPage(StringBucket& Bucket, uint32 MinPageSize);
 
-    void ResizeBucket(StringBucket& Bucket);
+    void GrowLookupIndex(uint64 MinNumEntries);
+    void AddToLookupIndex(uint64 FullHash, HashStringTableIndex Index);
 
     template<typename CharType>
     std::pair<HashStringTableIndex, bool> AddUnchecked(const CharType* Str, int32 Length, uint8 Hash);
 
+    /* Same as what FindOrAdd() does to an existing entry, when 'bShouldMarkAsDuplicated' is true */
+    void MarkAsDuplicated(const StringEntry& Entry) const;
+
 public:
     const StringEntry& operator[](HashStringTableIndex Index) const;
 
@@ -290,8 +380,9 @@ public:
     const StringBucket& GetBucket(uint32 Index) const;
     const StringEntry& GetStringEntry(HashStringTableIndex Index) const;
 
+    /* 'FullHash' is the FullWidthStringHash() of the string */
     template<typename CharType>
-    HashStringTableIndex Find(const CharType* Str, int32 Length, uint8 Hash);
+    HashStringTableIndex Find(const CharType* Str, int32 Length, uint64 FullHash);
 
     template<typename CharType>
     std::pair<HashStringTableIndex, bool> FindOrAdd(const CharType* Str, int32 Length, bool bShouldMarkAsDuplicated = true);
@@ -299,7 +390,34 @@ public:
     /* returns pair<Index, bWasAdded> */
     std::pair<HashStringTableIndex, bool> FindOrAdd(const std::string& String, bool bShouldMarkAsDuplicated = true);
 
-    int32 GetTotalUsedSize() const;
+    /*
+    * Same as FindOrAdd(), but the string is only created by 'GetString()' the first time 'Key' is seen. Later calls only look up the key.
+    * 
+    * The same key must always produce the same string, eg. the comparison-index and number of an FName for its valid name.
+    */
+    template<typename StringGetterType>
+    inline std::pair<HashStringTableIndex, bool> FindOrAddCached(uint64 Key, StringGetterType GetString, bool bShouldMarkAsDuplicated = true)
+    {
+        const auto [It, bInserted] = KeyedIndexCache.try_emplace(Key, HashStringTableIndex::FromInt(-1));
+
+        if (!bInserted)
+        {
+            if (bShouldMarkAsDuplicated && It->second != -1)
+                MarkAsDuplicated(GetStringEntry(It->second));
+
+            return { It->second, false };
+        }
+
+        const auto Result = FindOrAdd(GetString(), bShouldMarkAsDuplicated);
+        It->second = Result.first;
+
+        return Result;
+    }
+
+    /* Pre-allocates room for roughly 'ExpectedBytes' of strings, so no pages are added while the table is being filled */
+    void Reserve(uint64 ExpectedBytes);
+
+    uint64 GetTotalUsedSize() const;
 
 public:
     void DebugPrintStats() const;
@@ -95,6 +95,9 @@ namespace KeyFunctions
 	/* Make a unique key from UEProperty/UEFunction for NameTranslation */
 	uint64 GetKeyForCollisionInfo(UEStruct Super, UEProperty Member);
 	uint64 GetKeyForCollisionInfo(UEStruct Super, UEFunction Function);
+
+	/* Unique key for the text of an FName, for use with HashStringTable::FindOrAddCached() */
+	uint64 GetKeyForName(FName Name);
 }
 
 
@@ -140,12 +143,18 @@ public:
 
 	std::string StringifyName(UEStruct Struct, NameInfo Info);
 
+	/* Pre-allocates the string-table for member-names, see HashStringTable::Reserve() */
+	inline void ReserveNames(uint64 ExpectedBytes) { MemberNames.Reserve(ExpectedBytes); }
+
 public:
 	template<typename UEType>
-	inline NameInfo GetNameCollisionInfoUnchecked(UEStruct Struct, UEType Member)
+	inline NameInfo GetNameCollisionInfoUnchecked(UEStruct Struct, UEType Member) const
 	{
-		CollisionManager::NameContainer& InfosForStruct = NameInfos.at(Struct.GetIndex());
-		uint64 NameInfoIndex = TranslationMap[KeyFunctions::GetKeyForCollisionInfo(Struct, Member)];
+		const CollisionManager::NameContainer& InfosForStruct = NameInfos.at(Struct.GetIndex());
+
+		/* Must not insert, generators running at the same time call this. Members without an entry use the first NameInfo of the struct. */
+		const auto It = TranslationMap.find(KeyFunctions::GetKeyForCollisionInfo(Struct, Member));
+		const uint64 NameInfoIndex = It != TranslationMap.end() ? It->second : 0x0;
 
 		return InfosForStruct.at(NameInfoIndex);
 	}
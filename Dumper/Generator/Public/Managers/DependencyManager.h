@@ -17,9 +17,6 @@ public:
 private:
 	struct IndexDependencyInfo
 	{
-		/* Counter incremented every time this element is hit during iteration, **if** the counter is less than the CurrentIterationIndex */
-		mutable uint64 IterationHitCounter = 0x0;
-
 		/* Indices of Objects required by this Object */
 		std::unordered_set<int32> DependencyIndices;
 	};
@@ -28,16 +25,14 @@ private:
 	/* List of Objects and their Dependencies */
 	std::unordered_map<int32, IndexDependencyInfo> AllDependencies;
 
-	/* Count to track how often the Dependency-List was iterated. Allows for up to 2^64 iterations of this list. */
-	mutable uint64 CurrentIterationHitCount = 0x0;
-
 public:
 	DependencyManager() = default;
 
 	DependencyManager(int32 ObjectToTrack);
 
 private:
-	void VisitIndexAndDependencies(int32 Index, OnVisitCallbackType Callback) const;
+	/* Visiting doesn't modify the manager, the visited nodes are tracked per call. This allows multiple threads to visit the same manager at once. */
+	void VisitIndexAndDependencies(int32 Index, const OnVisitCallbackType& Callback, std::unordered_set<int32>& VisitedNodes) const;
 
 public:
 	void SetExists(const int32 DepedantIdx);
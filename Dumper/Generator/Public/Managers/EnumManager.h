@@ -95,6 +95,8 @@ public:
 	using IllegalNameContaierType = std::vector<HashStringTableIndex>;
 
 private:
+	/* Thread-safety: Only written by Init(), which may run concurrently with the Init() of other managers. Read-only after initialization. */
+
 	/* NameTable containing names of all enums as well as information on name-collisions */
 	static inline HashStringTable UniqueEnumNameTable;
 
@@ -180,10 +180,10 @@ private:
 	friend class CollisionManagerTest;
 
 private:
-	/* Map to lookup if a struct has predefined members */
-	static inline const PredefinedMemberLookupMapType* PredefinedMemberLookup = nullptr;
+	/* Map to lookup if a struct has predefined members. Per thread, generators running at the same time each use their own predefined members. */
+	static inline thread_local const PredefinedMemberLookupMapType* PredefinedMemberLookup = nullptr;
 
-	/* CollisionManager containing information on colliding member-/function-names */
+	/* CollisionManager containing information on colliding member-/function-names. Only written by Init(), which may run concurrently with the Init() of other managers. */
 	static inline CollisionManager MemberNames;
 
 private:
@@ -213,6 +213,7 @@ public:
 	FunctionIterator<true> IterateFunctions() const;
 
 public:
+	/* Only affects the calling thread, worker-threads started by a generator need to set it too */
 	static inline void SetPredefinedMemberLookupPtr(const PredefinedMemberLookupMapType* Lookup)
 	{
 		PredefinedMemberLookup = Lookup;
@@ -233,6 +234,9 @@ public:
 
 		bInitialized = true;
 
+		/* Rough estimate of the total size of all unique member-names, avoids adding pages to the string-table during init */
+		MemberNames.ReserveNames(ObjectArray::Num() * 0x8);
+
 		/* Adds special names first, to avoid name-collisions with predefined members */
 		InitReservedNames();
 
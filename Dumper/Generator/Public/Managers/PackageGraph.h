@@ -0,0 +1,98 @@
+#pragma once
+
+#include <span>
+#include <vector>
+#include <utility>
+#include <functional>
+
+#include "Unreal/Enums.h"
+
+
+/*
+* The include-graph of the packages, stored in compressed-sparse-row form.
+*
+* Every package has two nodes, one for its "_structs.hpp" and one for its "_classes.hpp" file. An edge from one node to another means the first file
+* includes the second one. Edges of a node are sorted by the node they point to.
+*/
+class PackageGraph
+{
+public:
+	using NodeIndex = int32;
+
+	enum class ELayer : uint8
+	{
+		Structs = 0,
+		Classes = 1,
+	};
+
+	struct PackageEdge
+	{
+		int32 FromPackage;
+		int32 ToPackage;
+
+		ELayer FromLayer;
+		ELayer ToLayer;
+	};
+
+	/* Node-indices of every component, components are ordered such that all components a component depends on come before it */
+	struct StronglyConnectedComponents
+	{
+		std::vector<int32> ComponentOfNode;
+
+		std::vector<int32> ComponentStarts;
+		std::vector<NodeIndex> Nodes;
+
+		inline int32 Num() const { return static_cast<int32>(ComponentStarts.size()) - 1; }
+
+		inline std::span<const NodeIndex> GetNodes(int32 Component) const
+		{
+			return std::span<const NodeIndex>(Nodes.data() + ComponentStarts[Component], ComponentStarts[Component + 1] - ComponentStarts[Component]);
+		}
+	};
+
+private:
+	/* Sorted, the position of a package in here is its slot */
+	std::vector<int32> Packages;
+
+	/* NumNodes() + 1 entries, the edges of 'Node' are [EdgeStarts[Node], EdgeStarts[Node + 1]) */
+	std::vector<int32> EdgeStarts;
+	std::vector<NodeIndex> Edges;
+
+public:
+	PackageGraph() = default;
+
+public:
+	/* 'PackageIndices' may be in any order, edges from or to packages that aren't part of the graph are dropped */
+	static PackageGraph Build(std::vector<int32> PackageIndices, const std::vector<PackageEdge>& PackageEdges);
+
+public:
+	inline int32 NumNodes() const { return static_cast<int32>(Packages.size() * 2); }
+	inline int32 NumEdges() const { return static_cast<int32>(Edges.size()); }
+
+	/* -1 if the package isn't part of the graph */
+	NodeIndex GetNode(int32 PackageIndex, ELayer Layer) const;
+
+	inline int32 GetPackageIndex(NodeIndex Node) const { return Packages[Node / 2]; }
+	inline ELayer GetLayer(NodeIndex Node) const { return static_cast<ELayer>(Node % 2); }
+
+	inline std::span<const NodeIndex> GetDependencies(NodeIndex Node) const
+	{
+		return std::span<const NodeIndex>(Edges.data() + EdgeStarts[Node], EdgeStarts[Node + 1] - EdgeStarts[Node]);
+	}
+
+	/* Position of the edge in [0, NumEdges()), -1 if there is no edge between the two nodes */
+	int32 FindEdge(NodeIndex From, NodeIndex To) const;
+	inline int32 GetFirstEdge(NodeIndex Node) const { return EdgeStarts[Node]; }
+	inline NodeIndex GetEdgeTarget(int32 Edge) const { return Edges[Edge]; }
+
+	/* Tarjan's algorithm, iterative, a single pass over all nodes and edges */
+	StronglyConnectedComponents FindStronglyConnectedComponents() const;
+
+	/*
+	* Edges to remove to make every component acyclic, one entry per edge, 1 if the edge is removed.
+	*
+	* Of every pair of nodes including each other one edge is removed first, From -> To if 'ShouldRemoveMutualEdge(From, To)' returns true and To -> From
+	* otherwise. The remaining cycles are broken by removing the back-edges of a depth-first search of each component.
+	*/
+	std::vector<uint8> FindEdgesBreakingCycles(const StronglyConnectedComponents& Components, const std::function<bool(NodeIndex From, NodeIndex To)>& ShouldRemoveMutualEdge) const;
+};
@@ -4,6 +4,7 @@
 #include "Unreal/UnrealObjects.h"
 
 #include "Managers/DependencyManager.h"
+#include "Managers/PackageGraph.h"
 #include "HashStringTable.h"
 
 
@@ -22,22 +23,11 @@ struct RequirementInfo
 	bool bShouldIncludeClasses;
 };
 
-struct VisitedNodeInformation
-{
-	int32 PackageIdx;
-	mutable uint64 StructsIterationHitCount = 0x0;
-	mutable uint64 ClassesIterationHitCount = 0x0;
-};
-
 using DependencyListType = std::unordered_map<int32, RequirementInfo>;
 
 
 struct DependencyInfo
 {
-	/* Counter incremented every time this element is hit during iteration, **if** the counter is less than the CurrentIterationIndex */
-	mutable uint64 StructsIterationHitCount = 0x0;
-	mutable uint64 ClassesIterationHitCount = 0x0;
-
 	/* List of packages required by "ThisPackage_structs.h" */
 	DependencyListType StructsDependencies;
 
@@ -48,15 +38,6 @@ struct DependencyInfo
 	DependencyListType ParametersDependencies;
 };
 
-struct IncludeData
-{
-	bool bIncludedStructs = false;
-	bool bIncludedClasses = false;
-};
-
-using VisitedNodeContainerType = std::unordered_map<int32, IncludeData>;
-
-
 struct PackageInfo
 {
 private:
@@ -144,17 +125,16 @@ private:
 
 private:
 	const MapType& PackageInfos;
-	uint8 CurrentIterationHitCount;
 	IteratorType It;
 
 private:
-	explicit PackageInfoIterator(const MapType& Infos, uint8 IterationHitCount, IteratorType ItPos)
-		: PackageInfos(Infos), CurrentIterationHitCount(IterationHitCount), It(ItPos)
+	explicit PackageInfoIterator(const MapType& Infos, IteratorType ItPos)
+		: PackageInfos(Infos), It(ItPos)
 	{
 	}
 
-	explicit PackageInfoIterator(const MapType& Infos, uint8 IterationHitCount)
-		: PackageInfos(Infos), CurrentIterationHitCount(IterationHitCount), It(Infos.cbegin())
+	explicit PackageInfoIterator(const MapType& Infos)
+		: PackageInfos(Infos), It(Infos.cbegin())
 	{
 	}
 
@@ -166,20 +146,8 @@ public:
 	inline bool operator!=(const PackageInfoIterator& Other) const { return It != Other.It; }
 
 public:
-	PackageInfoIterator begin() const { return PackageInfoIterator(PackageInfos, CurrentIterationHitCount, PackageInfos.cbegin()); }
-	PackageInfoIterator end() const   { return PackageInfoIterator(PackageInfos, CurrentIterationHitCount, PackageInfos.cend());   }
-};
-
-struct PackageManagerIterationParams
-{
-	int32 PrevPackage;
-	int32 RequiredPackage;
-
-	bool bWasPrevNodeStructs;
-	bool bRequiresClasses;
-	bool bRequiresStructs;
-
-	VisitedNodeContainerType& VisitedNodes;
+	PackageInfoIterator begin() const { return PackageInfoIterator(PackageInfos, PackageInfos.cbegin()); }
+	PackageInfoIterator end() const   { return PackageInfoIterator(PackageInfos, PackageInfos.cend());   }
 };
 
 class PackageManager
@@ -191,38 +159,21 @@ private:
 public:
 	using OverrideMaptType = PackageManagerOverrideMapType;
 
-	using IteratePackagesCallbackType = std::function<void(const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct)>;
-	using FindCycleCallbackType = std::function<void(const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct)>;
+	/* Called once for the "_structs.hpp" and once for the "_classes.hpp" file of every package */
+	using IteratePackagesCallbackType = std::function<void(int32 PackageIndex, bool bIsStruct)>;
 
 private:
-	struct SingleDependencyIterationParamsInternal
-	{
-		const IteratePackagesCallbackType& CallbackForEachPackage;
-		const FindCycleCallbackType& OnFoundCycle;
-
-		PackageManagerIterationParams& NewParams;
-		const PackageManagerIterationParams& OldParams;
-		const DependencyListType& Dependencies;
-		VisitedNodeContainerType& VisitedNodes;
-
-		int32 CurrentIndex;
-		int32 PrevIndex;
-		uint64& IterationHitCounterRef;
+	/*
+	* Thread-safety: Only written by Init() and PostInit(). Init() may run concurrently with the Init() of other managers, PostInit() runs after StructManager::Init().
+	* Afterwards the manager is read-only, iterating it doesn't modify any state. Generators running at the same time may all iterate it at once.
+	*/
 
-		bool bShouldHandlePackage;
-		bool bIsStruct;
-	};
-
-private:
 	/* NameTable containing names of all Packages as well as information on name-collisions */
 	static inline HashStringTable UniquePackageNameTable;
 
 	/* Map containing infos on all Packages. Implemented due to information missing in the Unreal's reflection system (PackageSize). */
 	static inline OverrideMaptType PackageInfos;
 
-	/* Count to track how often the PackageInfos was iterated. Allows for up to 2^64 iterations of this list. */
-	static inline uint64 CurrentIterationHitCount = 0x0;
-
 	static inline bool bIsInitialized = false;
 	static inline bool bIsPostInitialized = false;
 
@@ -231,6 +182,9 @@ private:
 	static void InitNames();
 	static void HandleCycles();
 
+	/* Removes the include of 'RequiredNode' from 'Node' and replaces what it provided by cycle-fixups and enum forward-declarations */
+	static void RemoveCyclicInclude(const PackageGraph& Graph, PackageGraph::NodeIndex Node, PackageGraph::NodeIndex RequiredNode);
+
 private:
 	static void HelperMarkStructDependenciesOfPackage(UEStruct Struct, int32 OwnPackageIdx, int32 RequiredPackageIdx, bool bIsClass);
 	static int32 HelperCountStructDependenciesOfPackage(UEStruct Struct, int32 OwnPackageIdx, bool bIsClass);
@@ -249,14 +203,12 @@ private:
 		return UniquePackageNameTable[Info.Name];
 	}
 
-private:
-	static void IterateSingleDependencyImplementation(SingleDependencyIterationParamsInternal& Params, bool bCheckForCycle);
-
-	static void IterateDependenciesImplementation(const PackageManagerIterationParams& Params, const IteratePackagesCallbackType& CallbackForEachPackage, const FindCycleCallbackType& OnFoundCycle, bool bCheckForCycle);
-
 public:
+	/* The include-graph as it currently is, after PostInit() it doesn't contain cycles anymore */
+	static PackageGraph BuildPackageGraph();
+
+	/* Visits every file after all files it includes */
 	static void IterateDependencies(const IteratePackagesCallbackType& CallbackForEachPackage);
-	static void FindCycle(const FindCycleCallbackType& OnFoundCycle);
 
 public:
 	static inline const OverrideMaptType& GetPackageInfos()
@@ -289,8 +241,6 @@ public:
 
 	static inline PackageInfoIterator IterateOverPackageInfos()
 	{
-		CurrentIterationHitCount++;
-
-		return PackageInfoIterator(PackageInfos, CurrentIterationHitCount);
+		return PackageInfoIterator(PackageInfos);
 	}
 };
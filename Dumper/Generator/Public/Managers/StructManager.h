@@ -85,6 +85,11 @@ public:
 	using CycleInfoListType = std::unordered_map<int32 /*StructIdx*/, std::unordered_set<int32 /* Packages cyclic with this structs' package */>>;
 
 private:
+	/*
+	* Thread-safety: These tables are only written by Init() and by PackageManager::PostInit(), which never runs at the same time as Init().
+	* Other managers may be initialized concurrently, so they must not access the StructManager during their Init(). Read-only after initialization.
+	*/
+
 	/* NameTable containing names of all structs/classes as well as information on name-collisions */
 	static inline HashStringTable UniqueNameTable;
 
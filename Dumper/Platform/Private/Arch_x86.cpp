@@ -3,6 +3,20 @@
 #include "Arch_x86.h"
 #include "Platform.h"
 
+
+const FunctionIndex& Architecture_x86_64::GetModuleFunctionIndex()
+{
+	/* The main module stays mapped at the same address for as long as the dumper is running */
+	static const FunctionIndex ModuleIndex = []() -> FunctionIndex
+	{
+		const uintptr_t ModuleBase = Platform::GetModuleBase();
+
+		return FunctionIndex::FromMappedImage(reinterpret_cast<const uint8_t*>(ModuleBase), 0x0, ModuleBase);
+	}();
+
+	return ModuleIndex;
+}
+
 // The processor (x86-64) only translates 52bits (or 57 bits) of a virtual address into a physical address and the unused bits need to be all 0 or all 1.
 bool Architecture_x86_64::IsValid64BitVirtualAddress(const uintptr_t Address)
 {
@@ -149,6 +163,10 @@ uintptr_t Architecture_x86_64::FindFunctionEnd(const uintptr_t Address, uint32_t
 	if (Range > 0xFFFF)
 		Range = 0xFFFF;
 
+	/* Exact if the function has unwind-info, leaf-functions don't and are searched for */
+	if (const uintptr_t FunctionEnd = GetModuleFunctionIndex().GetFunctionEnd(Address))
+		return (FunctionEnd - Address) <= Range ? FunctionEnd - 0x1 : NULL;
+
 	for (int i = 0; i < Range; i++)
 	{
 		if (IsFunctionRet(Address + i))
@@ -162,6 +180,12 @@ uintptr_t Architecture_x86_64::FindNextFunctionStart(const uintptr_t Address)
 	if (!Address)
 		return NULL;
 
+	const FunctionIndex& ModuleIndex = GetModuleFunctionIndex();
+
+	/* Leaf-functions in between are skipped, they have no unwind-info */
+	if (ModuleIndex.FindContainingFunction(Address).IsValid())
+		return ModuleIndex.GetNextFunctionStart(Address);
+
 	const uintptr_t FuncEnd = FindFunctionEnd(Address);
 
 	return FuncEnd % 0x10 != 0 ? FuncEnd + (0x10 - (FuncEnd % 0x10)) : FuncEnd;
@@ -190,6 +214,8 @@ uintptr_t Architecture_x86_64::GetRipRelativeCalledFunction(const uintptr_t Addr
 
 	const uint8_t* AsBytePtr = reinterpret_cast<const uint8_t*>(Address);
 
+	const FunctionIndex& ModuleIndex = GetModuleFunctionIndex();
+
 	for (int i = 0; i < 0xFFF; i++)
 	{
 		const int32_t Index = GetIndex(i);
@@ -204,6 +230,12 @@ uintptr_t Architecture_x86_64::GetRipRelativeCalledFunction(const uintptr_t Addr
 		if (!Platform::IsAddressInProcessRange(RelativeCallTarget))
 			continue;
 
+		/* Calls never target the inside of a function, this was an E8 byte that is part of another instruction */
+		const FunctionIndex::FunctionRange TargetFunction = ModuleIndex.FindContainingFunction(RelativeCallTarget);
+
+		if (TargetFunction.IsValid() && TargetFunction.Start != RelativeCallTarget)
+			continue;
+
 		if (++NumCalls == abs(OneBasedFuncIndex))
 		{
 			/* This is not the target we wanted, even tho it's at the right index. Decrement the index to the value before and check if the next call satisfies the custom-condition. */
@@ -1,6 +1,8 @@
 #pragma once
 #include <cstdint>
 
+#include "FunctionIndex.h"
+
 namespace Architecture_x86_64
 {
 	bool IsValid64BitVirtualAddress(const uintptr_t Address);
@@ -22,10 +24,14 @@ namespace Architecture_x86_64
 	bool IsFunctionRet(const uintptr_t Address);
 	uintptr_t ResolveJumpIfInstructionIsJump(const uintptr_t Address, const uintptr_t DefaultReturnValueOnFail = NULL);
 
-	/* Note: Unrealiable */
+	/* Function-boundaries of the main module from its exception directory, built on first use. Empty for 32-bit images. */
+	const FunctionIndex& GetModuleFunctionIndex();
+
+	/* Note: Unrealiable if 'Address' isn't inside of a function listed in GetModuleFunctionIndex() */
 	uintptr_t FindNextFunctionStart(const uintptr_t Address);
 	uintptr_t FindNextFunctionStart(const void* Address);
 
+	/* Returns the last byte of the function, which is the address of its 'ret' if the end had to be searched for */
 	uintptr_t FindFunctionEnd(const uintptr_t Address, uint32_t Range = 0xFFFF);
 
 	/*
@@ -0,0 +1,311 @@
+#include <cstring>
+#include <algorithm>
+
+#include "FunctionIndex.h"
+#include "PEFormat.h"
+
+
+using namespace PEFormat;
+
+namespace
+{
+	struct ImageLayout
+	{
+		const uint8_t* Data;
+		size_t Size;
+
+		size_t FirstSection;
+		uint16_t NumSections;
+
+		bool bIsFileLayout;
+	};
+
+	/* Offset into 'Data' at which the byte at 'Rva' is stored. On disk it's located through the raw-data of the section that contains it. */
+	bool RvaToOffset(const ImageLayout& Layout, uint32_t Rva, size_t& OutOffset)
+	{
+		if (!Layout.bIsFileLayout)
+		{
+			OutOffset = Rva;
+			return Rva < Layout.Size;
+		}
+
+		for (uint16_t i = 0; i < Layout.NumSections; i++)
+		{
+			const size_t Section = Layout.FirstSection + (i * SectionHeaderSize);
+
+			uint32_t VirtualAddress = 0x0;
+			uint32_t SizeOfRawData = 0x0;
+			uint32_t PointerToRawData = 0x0;
+
+			const bool bReadSection = ReadAt(Layout.Data, Layout.Size, Section + SectionHeaderVirtualAddressOffset, VirtualAddress)
+				&& ReadAt(Layout.Data, Layout.Size, Section + SectionHeaderSizeOfRawDataOffset, SizeOfRawData)
+				&& ReadAt(Layout.Data, Layout.Size, Section + SectionHeaderPointerToRawDataOffset, PointerToRawData);
+
+			if (!bReadSection)
+				return false;
+
+			if (Rva < VirtualAddress || (Rva - VirtualAddress) >= SizeOfRawData)
+				continue;
+
+			OutOffset = static_cast<size_t>(PointerToRawData) + (Rva - VirtualAddress);
+			return OutOffset < Layout.Size;
+		}
+
+		return false;
+	}
+
+	/* Follows the chained unwind-info of a RUNTIME_FUNCTION to the BeginRva of the function it's a part of, 'BeginRva' if it isn't chained */
+	uint32_t ResolvePrimaryBeginRva(const ImageLayout& Layout, uint32_t BeginRva, uint32_t UnwindInfoRva)
+	{
+		/* Chains are only a few entries long, the limit guards against malformed images */
+		constexpr int32_t MaxChainDepth = 0x20;
+
+		for (int32_t i = 0; i < MaxChainDepth; i++)
+		{
+			size_t ChainedEntryOffset = 0x0;
+
+			if (UnwindInfoRva & RuntimeFunctionIndirectFlag)
+			{
+				if (!RvaToOffset(Layout, UnwindInfoRva & ~RuntimeFunctionIndirectFlag, ChainedEntryOffset))
+					break;
+			}
+			else
+			{
+				size_t UnwindInfoOffset = 0x0;
+				uint8_t VersionAndFlags = 0x0;
+				uint8_t CountOfCodes = 0x0;
+
+				const bool bReadUnwindInfo = RvaToOffset(Layout, UnwindInfoRva, UnwindInfoOffset)
+					&& ReadAt(Layout.Data, Layout.Size, UnwindInfoOffset, VersionAndFlags)
+					&& ReadAt(Layout.Data, Layout.Size, UnwindInfoOffset + UnwindInfoCountOfCodesOffset, CountOfCodes);
+
+				if (!bReadUnwindInfo || ((VersionAndFlags >> UnwindInfoFlagsShift) & UnwindFlagChainInfo) == 0x0)
+					break;
+
+				/* The chained RUNTIME_FUNCTION follows the unwind-codes, their count is rounded up to an even number */
+				const size_t NumCodeSlots = (static_cast<size_t>(CountOfCodes) + 0x1) & ~static_cast<size_t>(0x1);
+
+				ChainedEntryOffset = UnwindInfoOffset + UnwindInfoCodesOffset + (NumCodeSlots * UnwindCodeSize);
+			}
+
+			uint32_t ChainedBeginRva = 0x0;
+			uint32_t ChainedUnwindInfoRva = 0x0;
+
+			if (!ReadAt(Layout.Data, Layout.Size, ChainedEntryOffset, ChainedBeginRva) || !ReadAt(Layout.Data, Layout.Size, ChainedEntryOffset + RuntimeFunctionUnwindInfoOffset, ChainedUnwindInfoRva))
+				break;
+
+			BeginRva = ChainedBeginRva;
+			UnwindInfoRva = ChainedUnwindInfoRva;
+		}
+
+		return BeginRva;
+	}
+}
+
+FunctionIndex FunctionIndex::FromImage(const uint8_t* Data, size_t Size, uintptr_t ImageBase, bool bIsFileLayout)
+{
+	FunctionIndex Index;
+	Index.ImageBase = ImageBase;
+
+	if (!Data)
+		return Index;
+
+	/* The headers of a mapped image are always readable, the size of the whole image is taken from them */
+	constexpr size_t MinHeadersSize = 0x1000;
+
+	const size_t HeadersSize = Size != 0x0 ? Size : MinHeadersSize;
+
+	uint16_t DosMagic = 0x0;
+	if (!ReadAt(Data, HeadersSize, 0x0, DosMagic) || DosMagic != DosSignature)
+		return Index;
+
+	int32_t NtHeadersOffset = 0x0;
+	if (!ReadAt(Data, HeadersSize, DosHeaderLfanewOffset, NtHeadersOffset) || NtHeadersOffset <= 0x0)
+		return Index;
+
+	const size_t NtHeaders = static_cast<size_t>(NtHeadersOffset);
+	const size_t OptionalHeader = NtHeaders + NtHeadersOptionalHeaderOffset;
+
+	uint32_t PeSignature = 0x0;
+	uint16_t NumSections = 0x0;
+	uint16_t SizeOfOptionalHeader = 0x0;
+	uint16_t OptionalHeaderMagic = 0x0;
+	uint32_t SizeOfImage = 0x0;
+	uint32_t NumRvaAndSizes = 0x0;
+
+	const bool bReadHeaders = ReadAt(Data, HeadersSize, NtHeaders, PeSignature)
+		&& ReadAt(Data, HeadersSize, NtHeaders + NtHeadersNumSectionsOffset, NumSections)
+		&& ReadAt(Data, HeadersSize, NtHeaders + NtHeadersSizeOfOptionalHeaderOffset, SizeOfOptionalHeader)
+		&& ReadAt(Data, HeadersSize, OptionalHeader + OptionalHeaderMagicOffset, OptionalHeaderMagic)
+		&& ReadAt(Data, HeadersSize, OptionalHeader + OptionalHeaderSizeOfImageOffset, SizeOfImage)
+		&& ReadAt(Data, HeadersSize, OptionalHeader + OptionalHeaderNumRvaAndSizesOffset, NumRvaAndSizes);
+
+	/* PE32 images have no exception directory with function-ranges, x86 unwinding doesn't use one */
+	if (!bReadHeaders || PeSignature != NtSignature || OptionalHeaderMagic != OptionalHeaderMagicPE32Plus || NumRvaAndSizes <= ExceptionDirectoryIndex)
+		return Index;
+
+	if (Size == 0x0)
+		Size = SizeOfImage;
+
+	const size_t ExceptionDirectory = OptionalHeader + OptionalHeaderDataDirectoriesOffset + (ExceptionDirectoryIndex * DataDirectorySize);
+
+	uint32_t ExceptionDirectoryRva = 0x0;
+	uint32_t ExceptionDirectorySize = 0x0;
+
+	if (!ReadAt(Data, Size, ExceptionDirectory, ExceptionDirectoryRva) || !ReadAt(Data, Size, ExceptionDirectory + 0x4, ExceptionDirectorySize))
+		return Index;
+
+	if (ExceptionDirectoryRva == 0x0 || ExceptionDirectorySize < RuntimeFunctionSize)
+		return Index;
+
+	const ImageLayout Layout = { Data, Size, OptionalHeader + SizeOfOptionalHeader, NumSections, bIsFileLayout };
+
+	size_t ExceptionDirectoryOffset = 0x0;
+	if (!RvaToOffset(Layout, ExceptionDirectoryRva, ExceptionDirectoryOffset))
+		return Index;
+
+	const size_t NumEntries = ExceptionDirectorySize / RuntimeFunctionSize;
+
+	if (ExceptionDirectoryOffset > Size || (Size - ExceptionDirectoryOffset) / RuntimeFunctionSize < NumEntries)
+		return Index;
+
+	Index.Functions.reserve(NumEntries);
+
+	for (size_t i = 0; i < NumEntries; i++)
+	{
+		const uint8_t* Entry = Data + ExceptionDirectoryOffset + (i * RuntimeFunctionSize);
+
+		/* BeginAddress, EndAddress, UnwindInfoAddress */
+		RuntimeFunction Function;
+		std::memcpy(&Function.BeginRva, Entry + 0x0, sizeof(uint32_t));
+		std::memcpy(&Function.EndRva, Entry + 0x4, sizeof(uint32_t));
+
+		uint32_t UnwindInfoRva = 0x0;
+		std::memcpy(&UnwindInfoRva, Entry + RuntimeFunctionUnwindInfoOffset, sizeof(uint32_t));
+
+		if (Function.BeginRva >= Function.EndRva)
+			continue;
+
+		Function.PrimaryBeginRva = ResolvePrimaryBeginRva(Layout, Function.BeginRva, UnwindInfoRva);
+
+		Index.Functions.push_back(Function);
+	}
+
+	/* The linker emits them sorted already, but nothing requires it to */
+	if (!std::is_sorted(Index.Functions.begin(), Index.Functions.end(), [](const RuntimeFunction& L, const RuntimeFunction& R) { return L.BeginRva < R.BeginRva; }))
+		std::sort(Index.Functions.begin(), Index.Functions.end(), [](const RuntimeFunction& L, const RuntimeFunction& R) { return L.BeginRva < R.BeginRva; });
+
+	return Index;
+}
+
+FunctionIndex FunctionIndex::FromFileBuffer(const uint8_t* Data, size_t Size, uintptr_t ImageBase)
+{
+	if (Size == 0x0)
+		return FunctionIndex();
+
+	return FromImage(Data, Size, ImageBase, true);
+}
+
+FunctionIndex FunctionIndex::FromMappedImage(const uint8_t* Image, size_t Size, uintptr_t ImageBase)
+{
+	return FromImage(Image, Size, ImageBase, false);
+}
+
+const FunctionIndex::RuntimeFunction* FunctionIndex::FindEntry(uintptr_t Address) const
+{
+	if (Address < ImageBase || (Address - ImageBase) > UINT32_MAX)
+		return nullptr;
+
+	const uint32_t Rva = static_cast<uint32_t>(Address - ImageBase);
+
+	/* First function starting after 'Rva', the one before it is the only one that could contain it */
+	auto It = std::upper_bound(Functions.begin(), Functions.end(), Rva, [](uint32_t Value, const RuntimeFunction& Function) { return Value < Function.BeginRva; });
+
+	if (It == Functions.begin())
+		return nullptr;
+
+	--It;
+
+	return Rva < It->EndRva ? &*It : nullptr;
+}
+
+uint32_t FunctionIndex::GetContiguousEndRva(const RuntimeFunction* Entry) const
+{
+	const RuntimeFunction* const EntriesEnd = Functions.data() + Functions.size();
+
+	uint32_t EndRva = Entry->EndRva;
+
+	for (const RuntimeFunction* Next = Entry + 0x1; Next != EntriesEnd; Next++)
+	{
+		if (Next->BeginRva != EndRva || Next->PrimaryBeginRva != Entry->PrimaryBeginRva)
+			break;
+
+		EndRva = Next->EndRva;
+	}
+
+	return EndRva;
+}
+
+FunctionIndex::FunctionRange FunctionIndex::FindContainingFunction(uintptr_t Address) const
+{
+	const RuntimeFunction* Function = FindEntry(Address);
+
+	if (!Function)
+		return FunctionRange();
+
+	/* Chained parts are reported as the function they belong to */
+	if (!Function->IsPrimary())
+	{
+		const RuntimeFunction* Primary = FindEntry(ImageBase + Function->PrimaryBeginRva);
+
+		if (!Primary || Primary->BeginRva != Function->PrimaryBeginRva)
+			return FunctionRange();
+
+		Function = Primary;
+	}
+
+	return FunctionRange{ ImageBase + Function->BeginRva, ImageBase + GetContiguousEndRva(Function) };
+}
+
+uintptr_t FunctionIndex::GetFunctionStart(uintptr_t Address) const
+{
+	return FindContainingFunction(Address).Start;
+}
+
+uintptr_t FunctionIndex::GetFunctionEnd(uintptr_t Address) const
+{
+	const RuntimeFunction* Function = FindEntry(Address);
+
+	return Function ? ImageBase + GetContiguousEndRva(Function) : 0x0;
+}
+
+uintptr_t FunctionIndex::GetNextFunctionStart(uintptr_t Address) const
+{
+	if (Address < ImageBase)
+		return Functions.empty() ? 0x0 : ImageBase + Functions.front().BeginRva;
+
+	if ((Address - ImageBase) > UINT32_MAX)
+		return 0x0;
+
+	const uint32_t Rva = static_cast<uint32_t>(Address - ImageBase);
+
+	/* Parts of a function can be placed before its entry, the entry then isn't the start of the next function */
+	const RuntimeFunction* ContainingFunction = FindEntry(Address);
+
+	auto It = std::upper_bound(Functions.begin(), Functions.end(), Rva, [](uint32_t Value, const RuntimeFunction& Function) { return Value < Function.BeginRva; });
+
+	for (; It != Functions.end(); ++It)
+	{
+		if (It->IsPrimary() && (!ContainingFunction || It->BeginRva != ContainingFunction->PrimaryBeginRva))
+			return ImageBase + It->BeginRva;
+	}
+
+	return 0x0;
+}
+
+bool FunctionIndex::IsFunctionStart(uintptr_t Address) const
+{
+	const RuntimeFunction* Function = FindEntry(Address);
+
+	return Function && Function->IsPrimary() && (ImageBase + Function->BeginRva) == Address;
+}
@@ -0,0 +1,247 @@
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+
+#include "PEImage.h"
+#include "PEFormat.h"
+
+
+using namespace PEFormat;
+
+bool PEImage::LoadFromFile(const std::string& FilePath)
+{
+	Reset();
+
+	std::ifstream File(FilePath, std::ios::binary | std::ios::ate);
+
+	if (!File.is_open())
+		return false;
+
+	const std::streamsize FileSize = File.tellg();
+
+	if (FileSize <= 0x0)
+		return false;
+
+	std::vector<uint8_t> FileData(static_cast<size_t>(FileSize));
+
+	File.seekg(0x0, std::ios::beg);
+
+	if (!File.read(reinterpret_cast<char*>(FileData.data()), FileSize))
+		return false;
+
+	if (!LoadFromBuffer(FileData.data(), FileData.size()))
+		return false;
+
+	const size_t LastSeparator = FilePath.find_last_of("/\\");
+
+	ModuleName = LastSeparator != std::string::npos ? FilePath.substr(LastSeparator + 1) : FilePath;
+	std::transform(ModuleName.begin(), ModuleName.end(), ModuleName.begin(), [](unsigned char C) { return static_cast<char>(std::tolower(C)); });
+
+	return true;
+}
+
+bool PEImage::LoadFromBuffer(const uint8_t* Data, size_t Size)
+{
+	Reset();
+
+	uint16_t DosMagic = 0x0;
+	if (!Data || !ReadAt(Data, Size, 0x0, DosMagic) || DosMagic != DosSignature)
+		return false;
+
+	int32_t NtHeadersOffset = 0x0;
+	if (!ReadAt(Data, Size, DosHeaderLfanewOffset, NtHeadersOffset) || NtHeadersOffset <= 0x0)
+		return false;
+
+	const size_t NtHeaders = static_cast<size_t>(NtHeadersOffset);
+	const size_t OptionalHeader = NtHeaders + NtHeadersOptionalHeaderOffset;
+
+	uint32_t PeSignature = 0x0;
+	uint16_t NumSections = 0x0;
+	uint16_t SizeOfOptionalHeader = 0x0;
+	uint16_t OptionalHeaderMagic = 0x0;
+	uint32_t NewSizeOfImage = 0x0;
+	uint32_t SizeOfHeaders = 0x0;
+
+	const bool bReadHeaders = ReadAt(Data, Size, NtHeaders, PeSignature)
+		&& ReadAt(Data, Size, NtHeaders + NtHeadersNumSectionsOffset, NumSections)
+		&& ReadAt(Data, Size, NtHeaders + NtHeadersSizeOfOptionalHeaderOffset, SizeOfOptionalHeader)
+		&& ReadAt(Data, Size, OptionalHeader + OptionalHeaderMagicOffset, OptionalHeaderMagic)
+		&& ReadAt(Data, Size, OptionalHeader + OptionalHeaderSizeOfImageOffset, NewSizeOfImage)
+		&& ReadAt(Data, Size, OptionalHeader + OptionalHeaderSizeOfHeadersOffset, SizeOfHeaders);
+
+	if (!bReadHeaders || PeSignature != NtSignature || NewSizeOfImage == 0x0)
+		return false;
+
+	/* The image-base is 4 bytes in PE32 and 8 bytes in PE32+ images */
+	uint64_t NewPreferredImageBase = 0x0;
+
+	if (OptionalHeaderMagic == OptionalHeaderMagicPE32Plus)
+	{
+		if (!ReadAt(Data, Size, OptionalHeader + OptionalHeaderImageBaseOffsetPE32Plus, NewPreferredImageBase))
+			return false;
+	}
+	else if (OptionalHeaderMagic == OptionalHeaderMagicPE32)
+	{
+		uint32_t ImageBase32 = 0x0;
+
+		if (!ReadAt(Data, Size, OptionalHeader + OptionalHeaderImageBaseOffsetPE32, ImageBase32))
+			return false;
+
+		NewPreferredImageBase = ImageBase32;
+	}
+	else
+	{
+		return false;
+	}
+
+	/* Zero-initialized, the parts of a section that aren't backed by the file are zero when mapped by the loader as well */
+	std::unique_ptr<uint8_t[]> NewImage = std::make_unique<uint8_t[]>(NewSizeOfImage);
+
+	const size_t HeadersToCopy = SizeOfHeaders < NewSizeOfImage ? SizeOfHeaders : NewSizeOfImage;
+	std::memcpy(NewImage.get(), Data, HeadersToCopy < Size ? HeadersToCopy : Size);
+
+	const size_t FirstSection = OptionalHeader + SizeOfOptionalHeader;
+
+	for (uint16_t i = 0; i < NumSections; i++)
+	{
+		const size_t SectionHeader = FirstSection + (i * SectionHeaderSize);
+
+		uint32_t VirtualSize = 0x0;
+		uint32_t VirtualAddress = 0x0;
+		uint32_t SizeOfRawData = 0x0;
+		uint32_t PointerToRawData = 0x0;
+
+		const bool bReadSection = ReadAt(Data, Size, SectionHeader + SectionHeaderVirtualSizeOffset, VirtualSize)
+			&& ReadAt(Data, Size, SectionHeader + SectionHeaderVirtualAddressOffset, VirtualAddress)
+			&& ReadAt(Data, Size, SectionHeader + SectionHeaderSizeOfRawDataOffset, SizeOfRawData)
+			&& ReadAt(Data, Size, SectionHeader + SectionHeaderPointerToRawDataOffset, PointerToRawData);
+
+		if (!bReadSection || VirtualAddress >= NewSizeOfImage)
+			return false;
+
+		/* Some linkers leave the virtual-size at 0 for sections that are entirely backed by the file */
+		if (VirtualSize == 0x0)
+			VirtualSize = SizeOfRawData;
+
+		const uint32_t SpaceInImage = NewSizeOfImage - VirtualAddress;
+
+		if (VirtualSize > SpaceInImage)
+			VirtualSize = SpaceInImage;
+
+		/* Only the part of the raw-data that lies within the file and the virtual-size of the section is mapped */
+		uint32_t BytesToCopy = SizeOfRawData < VirtualSize ? SizeOfRawData : VirtualSize;
+
+		if (PointerToRawData >= Size)
+			BytesToCopy = 0x0;
+		else if (BytesToCopy > (Size - PointerToRawData))
+			BytesToCopy = static_cast<uint32_t>(Size - PointerToRawData);
+
+		if (BytesToCopy > 0x0)
+			std::memcpy(NewImage.get() + VirtualAddress, Data + PointerToRawData, BytesToCopy);
+	}
+
+	Image = std::move(NewImage);
+	SizeOfImage = NewSizeOfImage;
+	PreferredImageBase = NewPreferredImageBase;
+
+	if (!ApplyBaseRelocations(OptionalHeader, OptionalHeaderMagic))
+	{
+		Reset();
+		return false;
+	}
+
+	return true;
+}
+
+bool PEImage::ApplyBaseRelocations(size_t OptionalHeader, uint16_t OptionalHeaderMagic)
+{
+	const bool bIsPE32Plus = OptionalHeaderMagic == OptionalHeaderMagicPE32Plus;
+
+	const size_t NumRvaAndSizesOffset = bIsPE32Plus ? OptionalHeaderNumRvaAndSizesOffset : OptionalHeaderNumRvaAndSizesOffsetPE32;
+	const size_t DataDirectoriesOffset = bIsPE32Plus ? OptionalHeaderDataDirectoriesOffset : OptionalHeaderDataDirectoriesOffsetPE32;
+
+	uint8_t* const Data = Image.get();
+
+	uint32_t NumRvaAndSizes = 0x0;
+	if (!ReadAt(Data, SizeOfImage, OptionalHeader + NumRvaAndSizesOffset, NumRvaAndSizes))
+		return false;
+
+	if (NumRvaAndSizes <= BaseRelocationDirectoryIndex)
+		return true;
+
+	const size_t RelocationDirectory = OptionalHeader + DataDirectoriesOffset + (BaseRelocationDirectoryIndex * DataDirectorySize);
+
+	uint32_t RelocationsRva = 0x0;
+	uint32_t RelocationsSize = 0x0;
+
+	if (!ReadAt(Data, SizeOfImage, RelocationDirectory, RelocationsRva) || !ReadAt(Data, SizeOfImage, RelocationDirectory + 0x4, RelocationsSize))
+		return false;
+
+	if (RelocationsRva == 0x0 || RelocationsSize == 0x0)
+		return true;
+
+	if (RelocationsRva >= SizeOfImage || RelocationsSize > (SizeOfImage - RelocationsRva))
+		return false;
+
+	/* Wraps around if the buffer is below the preferred image-base, adding it still moves every address by the right amount */
+	const uint64_t Delta = static_cast<uint64_t>(GetBase()) - PreferredImageBase;
+
+	const size_t RelocationsEnd = static_cast<size_t>(RelocationsRva) + RelocationsSize;
+
+	for (size_t Block = RelocationsRva; (RelocationsEnd - Block) >= BaseRelocationBlockHeaderSize;)
+	{
+		uint32_t PageRva = 0x0;
+		uint32_t BlockSize = 0x0;
+
+		if (!ReadAt(Data, SizeOfImage, Block, PageRva) || !ReadAt(Data, SizeOfImage, Block + 0x4, BlockSize))
+			return false;
+
+		if (BlockSize < BaseRelocationBlockHeaderSize || BlockSize > (RelocationsEnd - Block))
+			return false;
+
+		const size_t NumEntries = (BlockSize - BaseRelocationBlockHeaderSize) / sizeof(uint16_t);
+
+		for (size_t i = 0; i < NumEntries; i++)
+		{
+			uint16_t Entry = 0x0;
+			ReadAt(Data, SizeOfImage, Block + BaseRelocationBlockHeaderSize + (i * sizeof(uint16_t)), Entry);
+
+			const uint8_t Type = static_cast<uint8_t>(Entry >> BaseRelocationTypeShift);
+			const size_t Target = static_cast<size_t>(PageRva) + (Entry & BaseRelocationOffsetMask);
+
+			/* IMAGE_REL_BASED_ABSOLUTE entries are padding, no other types are used by x86 and x64 images */
+			if (Type == BaseRelocationTypeDir64)
+			{
+				uint64_t Value = 0x0;
+				if (!ReadAt(Data, SizeOfImage, Target, Value))
+					return false;
+
+				Value += Delta;
+				std::memcpy(Data + Target, &Value, sizeof(Value));
+			}
+			else if (Type == BaseRelocationTypeHighLow)
+			{
+				uint32_t Value = 0x0;
+				if (!ReadAt(Data, SizeOfImage, Target, Value))
+					return false;
+
+				Value += static_cast<uint32_t>(Delta);
+				std::memcpy(Data + Target, &Value, sizeof(Value));
+			}
+		}
+
+		Block += BlockSize;
+	}
+
+	return true;
+}
+
+void PEImage::Reset()
+{
+	Image.reset();
+	SizeOfImage = 0x0;
+	PreferredImageBase = 0x0;
+	ModuleName.clear();
+}
@@ -2,6 +2,11 @@
 #include "TmpUtils.h"
 #include "PlatformWindows.h"
 #include "Arch_x86.h"
+#include "Profiler/Profiler.h"
+#include "PEImage.h"
+
+#include <mutex>
+#include <unordered_map>
 
 // Private implementation to ensure that there is no accidental usage of platform-specific functions
 namespace
@@ -9,6 +14,9 @@ namespace
 	// Spills over into the rest of the file (ouside of this anonymous namespace). This may be ignored, as all other functions in this file are part of namepsace PlatformWindows;
 	using namespace PlatformWindows;
 
+	/* Replaces the loaded module while static analysis is used, see PlatformWindows::LoadStaticImage() */
+	PEImage StaticImage;
+
 	struct WindowsSectionInfo
 	{
 		const uintptr_t Imagebase = NULL;
@@ -242,10 +250,13 @@ namespace
 			PIMAGE_THUNK_DATA NameThunk = reinterpret_cast<PIMAGE_THUNK_DATA>(ModuleBase + Import->OriginalFirstThunk);
 			PIMAGE_THUNK_DATA FuncThunk = reinterpret_cast<PIMAGE_THUNK_DATA>(ModuleBase + Import->FirstThunk);
 
+			/* The IAT of a static image wasn't filled by the loader, its entries are the same name-RVAs as the ones of the name-thunks */
+			const uintptr_t FuncThunkBase = StaticImage.IsInImage(ModuleBase) ? ModuleBase : 0x0;
+
 			while (!IsBadReadPtr(NameThunk)
 				&& !IsBadReadPtr(FuncThunk)
 				&& !IsBadReadPtr(ModuleBase + NameThunk->u1.AddressOfData)
-				&& !IsBadReadPtr(FuncThunk->u1.AddressOfData))
+				&& !IsBadReadPtr(FuncThunkBase + FuncThunk->u1.AddressOfData))
 			{
 				/*
 				* A functin might be imported using the Ordinal (Index) of this function in the modules export-table
@@ -327,6 +338,120 @@ namespace
 	{
 		return IsInAnySection(reinterpret_cast<uintptr_t>(Address), OptionalRequiredCharacteristics);
 	}
+
+	inline bool IsReadableMemoryInfo(const MEMORY_BASIC_INFORMATION& Mbi)
+	{
+		constexpr DWORD AccessibleMask = (PAGE_READONLY | PAGE_READWRITE | PAGE_WRITECOPY | PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY);
+		constexpr DWORD InaccessibleMask = (PAGE_GUARD | PAGE_NOACCESS);
+
+		return (Mbi.Protect & AccessibleMask) && !(Mbi.Protect & InaccessibleMask);
+	}
+
+	/* Calls 'Callback' with every run of readable pages in [Start, End). Sections of packed or protected games may contain pages that fault on access. */
+	inline void IterateReadableRanges(const uintptr_t Start, const uintptr_t End, const std::function<void(uintptr_t RunStart, uintptr_t RunEnd)>& Callback)
+	{
+		uintptr_t RunStart = 0x0;
+		uintptr_t Current = Start;
+
+		MEMORY_BASIC_INFORMATION Mbi;
+
+		while (Current < End && VirtualQuery(reinterpret_cast<const void*>(Current), &Mbi, sizeof(Mbi)))
+		{
+			const uintptr_t RegionEnd = reinterpret_cast<uintptr_t>(Mbi.BaseAddress) + Mbi.RegionSize;
+			const bool bIsReadable = Mbi.State == MEM_COMMIT && IsReadableMemoryInfo(Mbi);
+
+			/* Adjacent readable regions are merged, so matches crossing the border between them are found */
+			if (bIsReadable && RunStart == 0x0)
+			{
+				RunStart = Current;
+			}
+			else if (!bIsReadable && RunStart != 0x0)
+			{
+				Callback(RunStart, Current);
+				RunStart = 0x0;
+			}
+
+			Current = RegionEnd;
+		}
+
+		if (RunStart != 0x0)
+			Callback(RunStart, Current < End ? Current : End);
+	}
+
+	/* Addresses of all occurrences of 'Str', including its null-terminator, in the readable pages of the readable sections of the default module. Cached per string. */
+	template<typename CharType>
+	const std::vector<uintptr_t>& FindStringOccurrences(const CharType* Str)
+	{
+		static std::mutex CacheMutex;
+		static std::unordered_map<std::string, std::vector<uintptr_t>> Cache;
+
+		const std::string StrBytes(reinterpret_cast<const char*>(Str), (StrlenHelper(Str) + 1) * sizeof(CharType));
+
+		std::scoped_lock Lock(CacheMutex);
+
+		/* References to elements of an unordered_map stay valid on rehash */
+		const auto [It, bWasInserted] = Cache.try_emplace(StrBytes);
+
+		if (!bWasInserted)
+			return It->second;
+
+		const uintptr_t ModuleBase = GetModuleBase();
+		const std::boyer_moore_horspool_searcher Searcher(StrBytes.begin(), StrBytes.end());
+
+		/* IterateAllSectionObjects() already skips sections without IMAGE_SCN_MEM_READ */
+		IterateAllSectionObjects(ModuleBase, [&](const IMAGE_SECTION_HEADER* Section) -> bool
+		{
+			const uintptr_t SectionStart = ModuleBase + Section->VirtualAddress;
+
+			IterateReadableRanges(SectionStart, SectionStart + Section->Misc.VirtualSize, [&](uintptr_t RunStart, uintptr_t RunEnd) -> void
+			{
+				const char* RangeStart = reinterpret_cast<const char*>(RunStart);
+				const char* RangeEnd = reinterpret_cast<const char*>(RunEnd);
+
+				for (const char* Match = std::search(RangeStart, RangeEnd, Searcher); Match != RangeEnd; Match = std::search(Match + 1, RangeEnd, Searcher))
+					It->second.push_back(reinterpret_cast<uintptr_t>(Match));
+			});
+
+			return false;
+		});
+
+		return It->second;
+	}
+
+	/* Same result as the lea-sweep of FindByStringInAllSections<false>() over the executable sections of the default module, but using the xref-index */
+	template<typename CharType>
+	void* FindStringRefWithXRefIndex(const CharType* RefStr, const uintptr_t StartAddress)
+	{
+		const XRefIndex& Index = GetModuleXRefIndex();
+
+		uintptr_t Result = 0x0;
+
+		for (const uintptr_t StringAddress : FindStringOccurrences(RefStr))
+		{
+			for (const uint32_t SiteRva : Index.GetReferenceRvas(StringAddress))
+			{
+				const uintptr_t Site = Index.GetImageBase() + SiteRva;
+
+				if (Site < StartAddress)
+					continue;
+
+				/* Sites are sorted, no later one can be lower than the current result */
+				if (Result != 0x0 && Site >= Result)
+					break;
+
+				const uint8_t* Instruction = reinterpret_cast<const uint8_t*>(Site);
+
+				/* The index also contains movs referencing the string */
+				if ((Instruction[0] != 0x4C && Instruction[0] != 0x48) || Instruction[1] != 0x8D)
+					continue;
+
+				Result = Site;
+				break;
+			}
+		}
+
+		return reinterpret_cast<void*>(Result);
+	}
 }
 
 
@@ -385,8 +510,26 @@ void* WindowsPrivateImplHelper::FindAlignedValueInAllSectionsImpl(const void* Va
 
 
 
+bool PlatformWindows::LoadStaticImage(const std::string& FilePath)
+{
+	return StaticImage.LoadFromFile(FilePath);
+}
+
+void PlatformWindows::UnloadStaticImage()
+{
+	StaticImage.Reset();
+}
+
+bool PlatformWindows::IsUsingStaticImage()
+{
+	return StaticImage.IsLoaded();
+}
+
 uintptr_t PlatformWindows::GetModuleBase(const char* const ModuleName)
 {
+	if (StaticImage.IsLoaded() && (ModuleName == nullptr || Utils::StrToLower(ModuleName) == StaticImage.GetModuleName()))
+		return StaticImage.GetBase();
+
 	if (ModuleName == nullptr)
 		return reinterpret_cast<uintptr_t>(GetPEB()->ImageBaseAddress);
 
@@ -504,6 +647,8 @@ bool PlatformWindows::IsBadReadPtr(const uintptr_t Address)
 }
 bool PlatformWindows::IsBadReadPtr(const void* Address)
 {
+	Profiler::Increment(Profiler::ECounter::IsBadReadPtrCalls);
+
 	if constexpr (!Is32Bit())
 	{
 		if (!Architecture_x86_64::IsValid64BitVirtualAddress(Address))
@@ -513,12 +658,7 @@ bool PlatformWindows::IsBadReadPtr(const void* Address)
 	MEMORY_BASIC_INFORMATION Mbi;
 
 	if (VirtualQuery(Address, &Mbi, sizeof(Mbi)))
-	{
-		constexpr DWORD AccessibleMask = (PAGE_READONLY | PAGE_READWRITE | PAGE_WRITECOPY | PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY);
-		constexpr DWORD InaccessibleMask = (PAGE_GUARD | PAGE_NOACCESS);
-
-		return !(Mbi.Protect & AccessibleMask) || (Mbi.Protect & InaccessibleMask);
-	}
+		return !IsReadableMemoryInfo(Mbi);
 
 	return true;
 }
@@ -549,6 +689,36 @@ const void* PlatformWindows::GetAddressOfImportedFunctionFromAnyModule(const cha
 	return nullptr;
 }
 
+const XRefIndex& PlatformWindows::GetModuleXRefIndex()
+{
+	static const XRefIndex ModuleIndex = []() -> XRefIndex
+	{
+		const auto [ImageBase, ImageSize] = GetImageBaseAndSize();
+
+		std::vector<XRefIndex::CodeRange> CodeRanges;
+
+		IterateAllSectionObjects(ImageBase, [&](const IMAGE_SECTION_HEADER* Section) -> bool
+		{
+			if (!(Section->Characteristics & IMAGE_SCN_MEM_EXECUTE))
+				return false;
+
+			const uintptr_t SectionStart = ImageBase + Section->VirtualAddress;
+
+			/* Only pages that can be read are decoded */
+			IterateReadableRanges(SectionStart, SectionStart + Section->Misc.VirtualSize, [&](uintptr_t RunStart, uintptr_t RunEnd) -> void
+			{
+				CodeRanges.push_back(XRefIndex::CodeRange{ RunStart, RunEnd - RunStart });
+			});
+
+			return false;
+		});
+
+		return XRefIndex::Build(ImageBase, static_cast<uint32_t>(ImageSize), CodeRanges);
+	}();
+
+	return ModuleIndex;
+}
+
 const void* PlatformWindows::GetAddressOfExportedFunction(const char* SearchModuleName, const char* SearchFunctionName)
 {
 	/* Get the module the function was exported from */
@@ -698,6 +868,8 @@ void* PlatformWindows::FindPatternInRange(const char* Signature, const uintptr_t
 
 void* PlatformWindows::FindPatternInRange(std::vector<int>&& Signature, const void* Start, const uintptr_t Range, const bool bRelative, uint32_t Offset, const uint32_t SkipCount)
 {
+	Profiler::Increment(Profiler::ECounter::PatternScans);
+
 	const auto PatternLength = static_cast<int64_t>(Signature.size());
 	const auto PatternBytes = Signature.data();
 
@@ -743,6 +915,18 @@ void* PlatformWindows::FindByStringInAllSections(const CharType* RefStr,const ui
 {
 	static_assert(std::is_same_v<CharType, char> || std::is_same_v<CharType, wchar_t>, "FindByStringInAllSections only supports 'char' and 'wchar_t', but was called with other type.");
 
+#if defined(_WIN64)
+	/*
+	* Only a lea-instruction referencing the string is searched for, which is a lookup in the xref-index. With a 'StartAddress' the sweep below
+	* doesn't limit the search to 'Range' either, it returns the first reference after 'StartAddress' in any of the sections.
+	*/
+	if constexpr (!bCheckIfLeaIsStrPtr)
+	{
+		if (bSearchOnlyExecutableSections && ModuleName == Settings::General::DefaultModuleName && (StartAddress != 0x0 || Range <= 0x0))
+			return FindStringRefWithXRefIndex(RefStr, StartAddress);
+	}
+#endif
+
 	const auto ModuleBase = GetModuleBase(ModuleName);
 
 	void* Result = nullptr;
@@ -9,6 +9,7 @@
 #include <bit>
 
 #include "Settings.h"
+#include "XRefIndex.h"
 
 /*
 Interface:
@@ -120,6 +121,17 @@ namespace PlatformWindows
 #endif
 	}
 
+	/*
+	* Static analysis. Maps the PE file at 'FilePath' into a local image (see PEImage), which then replaces the default module and the module of the same name.
+	* The scan-functions (FindPattern, FindByStringInAllSections, GetSectionInfo, GetAddressOfImportedFunction, ...) run over the image and GetOffset() returns RVAs.
+	*
+	* Must be called before the first scan. The function- and xref-index of the default module are only built once, scans of the loaded module can't be used
+	* in the same session after the image was unloaded.
+	*/
+	bool LoadStaticImage(const std::string& FilePath);
+	void UnloadStaticImage();
+	bool IsUsingStaticImage();
+
 	uintptr_t GetModuleBase(const char* const ModuleName = Settings::General::DefaultModuleName);
 	uintptr_t GetOffset(const uintptr_t Address, const char* const ModuleName = Settings::General::DefaultModuleName);
 	uintptr_t GetOffset(const void* Address, const char* const ModuleName = Settings::General::DefaultModuleName);
@@ -140,6 +152,9 @@ namespace PlatformWindows
 
 	const void* GetAddressOfExportedFunction(const char* SearchModuleName, const char* SearchFunctionName);
 
+	/* RIP-relative references in the executable sections of the default module, built on first use */
+	const XRefIndex& GetModuleXRefIndex();
+
 	template<bool bShouldResolve32BitJumps = true>
 	std::pair<const void*, int32_t> IterateVTableFunctions(void** VTable, const std::function<bool(const uint8_t* Address, int32_t Index)>&CallBackForEachFunc, int32_t NumFunctions = 0x150, int32_t OffsetFromStart = 0x0);
 
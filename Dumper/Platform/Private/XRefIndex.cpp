@@ -0,0 +1,234 @@
+#include <bit>
+#include <cstring>
+#include <algorithm>
+
+#include "XRefIndex.h"
+#include "TaskGraph.h"
+
+
+namespace
+{
+	constexpr uint32_t HashMultiplier = 0x9E3779B1;
+
+	/* Target in the upper and site in the lower 32 bits, sorting these orders by target first and by site second */
+	inline uint64_t MakeReference(uint32_t TargetRva, uint32_t SiteRva)
+	{
+		return (static_cast<uint64_t>(TargetRva) << 32) | SiteRva;
+	}
+
+	inline uint32_t GetTargetRva(uint64_t Reference) { return static_cast<uint32_t>(Reference >> 32); }
+	inline uint32_t GetSiteRva(uint64_t Reference) { return static_cast<uint32_t>(Reference); }
+
+	inline int32_t ReadDisplacement(const uint8_t* Address)
+	{
+		int32_t Displacement;
+		std::memcpy(&Displacement, Address, sizeof(Displacement));
+
+		return Displacement;
+	}
+
+	void DecodeSlice(const XRefIndex::CodeRange& Range, size_t SliceStart, size_t SliceEnd, uintptr_t ImageBase, uint32_t ImageSize, std::vector<uint64_t>& OutReferences)
+	{
+		const uint8_t* Code = reinterpret_cast<const uint8_t*>(Range.Start);
+
+		auto AddIfInImage = [&](size_t Offset, size_t InstructionSize, size_t DisplacementOffset) -> void
+		{
+			const uintptr_t Site = Range.Start + Offset;
+			const uintptr_t Target = Site + InstructionSize + ReadDisplacement(Code + Offset + DisplacementOffset);
+
+			if (Target < ImageBase || (Target - ImageBase) >= ImageSize)
+				return;
+
+			OutReferences.push_back(MakeReference(static_cast<uint32_t>(Target - ImageBase), static_cast<uint32_t>(Site - ImageBase)));
+		};
+
+		for (size_t i = SliceStart; i < SliceEnd; i++)
+		{
+			/* Instructions may continue past the end of the slice, but not past the end of the range */
+			const size_t BytesLeft = Range.Size - i;
+
+			const uint8_t Opcode = Code[i];
+
+			/* call rel32, jmp rel32 */
+			if (Opcode == 0xE8 || Opcode == 0xE9)
+			{
+				if (BytesLeft >= 0x5)
+					AddIfInImage(i, 0x5, 0x1);
+			}
+			/* call [rip+rel32], jmp [rip+rel32] */
+			else if (Opcode == 0xFF)
+			{
+				if (BytesLeft >= 0x6 && (Code[i + 1] == 0x15 || Code[i + 1] == 0x25))
+					AddIfInImage(i, 0x6, 0x2);
+			}
+			/* REX.W lea/mov, modrm with mod == 00 and rm == 101 is [rip+rel32] */
+			else if ((Opcode & 0xF8) == 0x48)
+			{
+				if (BytesLeft < 0x7)
+					continue;
+
+				const uint8_t SecondByte = Code[i + 1];
+
+				if ((SecondByte == 0x8D || SecondByte == 0x8B || SecondByte == 0x89) && (Code[i + 2] & 0xC7) == 0x05)
+					AddIfInImage(i, 0x7, 0x3);
+			}
+		}
+	}
+}
+
+XRefIndex XRefIndex::Build(uintptr_t ImageBase, uint32_t ImageSize, const std::vector<CodeRange>& CodeRanges, uint32_t MaxThreads)
+{
+	XRefIndex Index;
+	Index.ImageBase = ImageBase;
+	Index.ImageSize = ImageSize;
+
+	struct Slice
+	{
+		const CodeRange* Range;
+		size_t Start;
+		size_t End;
+	};
+
+	std::vector<Slice> Slices;
+
+	for (const CodeRange& Range : CodeRanges)
+	{
+		for (size_t Start = 0x0; Start < Range.Size; Start += SliceSize)
+			Slices.push_back(Slice{ &Range, Start, (Range.Size - Start) > SliceSize ? Start + SliceSize : Range.Size });
+	}
+
+	if (Slices.empty())
+		return Index;
+
+	/* Every slice is decoded and sorted on its own, afterwards the sorted parts are merged pairwise */
+	std::vector<std::vector<uint64_t>> Parts(Slices.size());
+
+	ParallelFor(Slices.size(), [&](size_t SliceIdx) -> void
+	{
+		const Slice& CurrentSlice = Slices[SliceIdx];
+
+		DecodeSlice(*CurrentSlice.Range, CurrentSlice.Start, CurrentSlice.End, ImageBase, ImageSize, Parts[SliceIdx]);
+		std::sort(Parts[SliceIdx].begin(), Parts[SliceIdx].end());
+	}, MaxThreads);
+
+	while (Parts.size() > 0x1)
+	{
+		std::vector<std::vector<uint64_t>> MergedParts((Parts.size() + 1) / 2);
+
+		ParallelFor(MergedParts.size(), [&](size_t PairIdx) -> void
+		{
+			const size_t First = PairIdx * 2;
+
+			if ((First + 1) >= Parts.size())
+			{
+				MergedParts[PairIdx] = std::move(Parts[First]);
+				return;
+			}
+
+			std::vector<uint64_t>& Merged = MergedParts[PairIdx];
+			Merged.resize(Parts[First].size() + Parts[First + 1].size());
+
+			std::merge(Parts[First].begin(), Parts[First].end(), Parts[First + 1].begin(), Parts[First + 1].end(), Merged.begin());
+
+			std::vector<uint64_t>().swap(Parts[First]);
+			std::vector<uint64_t>().swap(Parts[First + 1]);
+		}, MaxThreads);
+
+		Parts = std::move(MergedParts);
+	}
+
+	const std::vector<uint64_t>& References = Parts[0];
+
+	if (References.empty())
+		return Index;
+
+	size_t NumTargets = 0x1;
+
+	for (size_t i = 1; i < References.size(); i++)
+	{
+		if (GetTargetRva(References[i]) != GetTargetRva(References[i - 1]))
+			NumTargets++;
+	}
+
+	/* At most half of the buckets are used, keeps the probe-sequences short */
+	size_t NumBuckets = 0x10;
+
+	while (NumBuckets < (NumTargets * 2))
+		NumBuckets *= 2;
+
+	const uint32_t HashShift = 32 - static_cast<uint32_t>(std::countr_zero(NumBuckets));
+
+	Index.Buckets.resize(NumBuckets);
+	Index.Sites.resize(References.size());
+
+	for (size_t i = 0; i < References.size(); i++)
+		Index.Sites[i] = GetSiteRva(References[i]);
+
+	for (size_t GroupStart = 0; GroupStart < References.size();)
+	{
+		const uint32_t TargetRva = GetTargetRva(References[GroupStart]);
+
+		size_t GroupEnd = GroupStart + 1;
+
+		while (GroupEnd < References.size() && GetTargetRva(References[GroupEnd]) == TargetRva)
+			GroupEnd++;
+
+		size_t BucketIdx = (TargetRva * HashMultiplier) >> HashShift;
+
+		while (Index.Buckets[BucketIdx].NumSites != 0x0)
+			BucketIdx = (BucketIdx + 1) & (NumBuckets - 1);
+
+		Index.Buckets[BucketIdx] = Bucket{ TargetRva, static_cast<uint32_t>(GroupStart), static_cast<uint32_t>(GroupEnd - GroupStart) };
+
+		GroupStart = GroupEnd;
+	}
+
+	return Index;
+}
+
+const XRefIndex::Bucket* XRefIndex::FindBucket(uint32_t TargetRva) const
+{
+	if (Buckets.empty())
+		return nullptr;
+
+	const size_t NumBuckets = Buckets.size();
+	const uint32_t HashShift = 32 - static_cast<uint32_t>(std::countr_zero(NumBuckets));
+
+	for (size_t BucketIdx = (TargetRva * HashMultiplier) >> HashShift; Buckets[BucketIdx].NumSites != 0x0; BucketIdx = (BucketIdx + 1) & (NumBuckets - 1))
+	{
+		if (Buckets[BucketIdx].TargetRva == TargetRva)
+			return &Buckets[BucketIdx];
+	}
+
+	return nullptr;
+}
+
+std::span<const uint32_t> XRefIndex::GetReferenceRvas(uintptr_t Target) const
+{
+	if (Target < ImageBase || (Target - ImageBase) >= ImageSize)
+		return {};
+
+	const Bucket* TargetBucket = FindBucket(static_cast<uint32_t>(Target - ImageBase));
+
+	if (!TargetBucket)
+		return {};
+
+	return std::span<const uint32_t>(Sites.data() + TargetBucket->FirstSite, TargetBucket->NumSites);
+}
+
+uintptr_t XRefIndex::FindFirstReference(uintptr_t Target, uintptr_t StartAddress, uintptr_t EndAddress) const
+{
+	const std::span<const uint32_t> References = GetReferenceRvas(Target);
+
+	if (References.empty() || EndAddress <= ImageBase)
+		return 0x0;
+
+	const uint32_t StartRva = StartAddress > ImageBase ? static_cast<uint32_t>(((StartAddress - ImageBase) < ImageSize ? (StartAddress - ImageBase) : ImageSize)) : 0x0;
+
+	auto It = std::lower_bound(References.begin(), References.end(), StartRva);
+
+	if (It == References.end() || (ImageBase + *It) >= EndAddress)
+		return 0x0;
+
+	return ImageBase + *It;
+}
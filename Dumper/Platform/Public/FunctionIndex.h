@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+/*
+* Function-boundaries of an x64 PE image, taken from the RUNTIME_FUNCTION entries of its exception directory (.pdata).
+*
+* The entries are parsed once into an array sorted by start-address, every query is a binary search. Leaf-functions that don't touch the
+* stack have no entry. Parts of a function that were split off by the compiler have their own entry with chained unwind-info
+* (UNW_FLAG_CHAININFO), those are resolved to the entry of the function they belong to, so queries never return a part as a function.
+*
+* Parsing only needs the bytes of the image, it doesn't depend on Windows headers or on the image being loaded.
+*/
+class FunctionIndex
+{
+public:
+	struct FunctionRange
+	{
+		/* Entry-point of the function */
+		uintptr_t Start = 0x0;
+
+		/* Exclusive, end of the function-body at 'Start' including the chained parts directly following it */
+		uintptr_t End = 0x0;
+
+		inline bool IsValid() const { return Start != End; }
+	};
+
+private:
+	struct RuntimeFunction
+	{
+		uint32_t BeginRva;
+		uint32_t EndRva;
+
+		/* BeginRva of the function this is a chained part of, equal to 'BeginRva' for the entry of a function itself */
+		uint32_t PrimaryBeginRva;
+
+		inline bool IsPrimary() const { return BeginRva == PrimaryBeginRva; }
+	};
+
+private:
+	/* Added to every RVA, addresses passed to and returned by the queries are relative to it */
+	uintptr_t ImageBase = 0x0;
+
+	/* Sorted by 'BeginRva', ranges don't overlap */
+	std::vector<RuntimeFunction> Functions;
+
+public:
+	FunctionIndex() = default;
+
+private:
+	static FunctionIndex FromImage(const uint8_t* Data, size_t Size, uintptr_t ImageBase, bool bIsFileLayout);
+
+	const RuntimeFunction* FindEntry(uintptr_t Address) const;
+
+	/* Exclusive end of 'Entry' merged with the following entries of the same function that directly continue it */
+	uint32_t GetContiguousEndRva(const RuntimeFunction* Entry) const;
+
+public:
+	/* 'Data' is the PE file as it is stored on disk, sections are located through their raw-data pointers */
+	static FunctionIndex FromFileBuffer(const uint8_t* Data, size_t Size, uintptr_t ImageBase = 0x0);
+
+	/* 'Image' is a PE image mapped by the loader, where an RVA is an offset from 'Image'. If 'Size' is 0 the SizeOfImage of the headers is used. */
+	static FunctionIndex FromMappedImage(const uint8_t* Image, size_t Size, uintptr_t ImageBase);
+
+public:
+	inline bool IsEmpty() const { return Functions.empty(); }
+	inline size_t Num() const { return Functions.size(); }
+
+	inline uintptr_t GetImageBase() const { return ImageBase; }
+
+	/* Range of the function 'Address' lies in, invalid if it isn't inside of any function. 'Address' can be outside of it if it's in a detached part. */
+	FunctionRange FindContainingFunction(uintptr_t Address) const;
+
+	/* 0 if 'Address' isn't inside of any function */
+	uintptr_t GetFunctionStart(uintptr_t Address) const;
+
+	/* Exclusive end of the code 'Address' is in, chained parts of the same function that directly follow it are included. 0 if 'Address' isn't inside of any function. */
+	uintptr_t GetFunctionEnd(uintptr_t Address) const;
+
+	/* Start of the first function after 'Address' that isn't the function 'Address' is in, chained parts are skipped. 0 if there is none. */
+	uintptr_t GetNextFunctionStart(uintptr_t Address) const;
+
+	bool IsFunctionStart(uintptr_t Address) const;
+};
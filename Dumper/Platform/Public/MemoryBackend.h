@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+
+/* Reads directly from the address space of this process. Used when the dumper is injected into the game. */
+class InProcessMemoryBackend
+{
+public:
+	template<typename T>
+	static inline T Read(const void* Address)
+	{
+		return *reinterpret_cast<const T*>(Address);
+	}
+
+	static inline bool ReadBytes(const void* Address, void* OutBuffer, size_t Size)
+	{
+		std::memcpy(OutBuffer, Address, Size);
+		return true;
+	}
+};
+
+
+/*
+* Reads of game-memory by the engine-layer, they compile down to the same plain dereference as before.
+*
+* UnrealObjects, the ObjectArray element-access and the NameArray getters read through here. The ObjectArray layout-detection, FNameEntry
+* strings and the OffsetFinder still dereference game-memory directly.
+*/
+namespace Memory
+{
+	using Backend = InProcessMemoryBackend;
+
+	template<typename T>
+	inline T Read(const void* Address)
+	{
+		return Backend::template Read<T>(Address);
+	}
+
+	template<typename T>
+	inline T Read(uintptr_t Address)
+	{
+		return Backend::template Read<T>(reinterpret_cast<const void*>(Address));
+	}
+
+	inline void* ReadPtr(const void* Address)
+	{
+		return Backend::template Read<void*>(Address);
+	}
+
+	inline bool ReadBytes(const void* Address, void* OutBuffer, size_t Size)
+	{
+		return Backend::ReadBytes(Address, OutBuffer, Size);
+	}
+}
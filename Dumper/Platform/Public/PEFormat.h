@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+
+/* Offsets into IMAGE_DOS_HEADER, IMAGE_NT_HEADERS64, IMAGE_SECTION_HEADER, IMAGE_BASE_RELOCATION, RUNTIME_FUNCTION and UNWIND_INFO, spelled out to not depend on Windows headers */
+namespace PEFormat
+{
+	constexpr uint16_t DosSignature = 0x5A4D; // 'MZ'
+	constexpr uint32_t NtSignature = 0x4550; // 'PE\0\0'
+
+	constexpr size_t DosHeaderLfanewOffset = 0x3C;
+	constexpr size_t NtHeadersNumSectionsOffset = 0x6;
+	constexpr size_t NtHeadersTimeDateStampOffset = 0x8;
+	constexpr size_t NtHeadersSizeOfOptionalHeaderOffset = 0x14;
+	constexpr size_t NtHeadersOptionalHeaderOffset = 0x18;
+
+	constexpr size_t OptionalHeaderMagicOffset = 0x0;
+	constexpr size_t OptionalHeaderImageBaseOffsetPE32 = 0x1C;
+	constexpr size_t OptionalHeaderImageBaseOffsetPE32Plus = 0x18;
+	constexpr size_t OptionalHeaderSizeOfImageOffset = 0x38;
+	constexpr size_t OptionalHeaderSizeOfHeadersOffset = 0x3C;
+	constexpr size_t OptionalHeaderNumRvaAndSizesOffsetPE32 = 0x5C;
+	constexpr size_t OptionalHeaderNumRvaAndSizesOffset = 0x6C;
+	constexpr size_t OptionalHeaderDataDirectoriesOffsetPE32 = 0x60;
+	constexpr size_t OptionalHeaderDataDirectoriesOffset = 0x70;
+
+	constexpr uint16_t OptionalHeaderMagicPE32 = 0x10B;
+	constexpr uint16_t OptionalHeaderMagicPE32Plus = 0x20B;
+
+	constexpr uint32_t ExceptionDirectoryIndex = 0x3;
+	constexpr uint32_t BaseRelocationDirectoryIndex = 0x5;
+	constexpr size_t DataDirectorySize = 0x8;
+
+	constexpr size_t SectionHeaderSize = 0x28;
+	constexpr size_t SectionHeaderVirtualSizeOffset = 0x8;
+	constexpr size_t SectionHeaderVirtualAddressOffset = 0xC;
+	constexpr size_t SectionHeaderSizeOfRawDataOffset = 0x10;
+	constexpr size_t SectionHeaderPointerToRawDataOffset = 0x14;
+	constexpr size_t SectionHeaderCharacteristicsOffset = 0x24;
+	constexpr size_t SectionNameLength = 0x8;
+
+	constexpr size_t RuntimeFunctionSize = 0xC;
+	constexpr size_t RuntimeFunctionUnwindInfoOffset = 0x8;
+
+	/* Set in the unwind-info RVA of a RUNTIME_FUNCTION that points to another RUNTIME_FUNCTION instead */
+	constexpr uint32_t RuntimeFunctionIndirectFlag = 0x1;
+
+	/* UNWIND_INFO, the flags are the upper 5 bits of the first byte */
+	constexpr size_t UnwindInfoCountOfCodesOffset = 0x2;
+	constexpr size_t UnwindInfoCodesOffset = 0x4;
+	constexpr size_t UnwindCodeSize = 0x2;
+	constexpr uint8_t UnwindInfoFlagsShift = 0x3;
+	constexpr uint8_t UnwindFlagChainInfo = 0x4;
+
+	/* IMAGE_BASE_RELOCATION blocks are followed by 16-bit entries, the type in the upper 4 bits and the offset into the page in the lower 12 */
+	constexpr size_t BaseRelocationBlockHeaderSize = 0x8;
+	constexpr uint16_t BaseRelocationOffsetMask = 0x0FFF;
+	constexpr uint8_t BaseRelocationTypeShift = 0xC;
+	constexpr uint8_t BaseRelocationTypeHighLow = 0x3;
+	constexpr uint8_t BaseRelocationTypeDir64 = 0xA;
+
+	/* Bounds-checked read of a 'T' at 'Offset' into the 'Size' bytes at 'Data', false if it doesn't fit */
+	template<typename T>
+	inline bool ReadAt(const uint8_t* Data, size_t Size, size_t Offset, T& OutValue)
+	{
+		if (Offset > Size || (Size - Offset) < sizeof(T))
+			return false;
+
+		std::memcpy(&OutValue, Data + Offset, sizeof(T));
+		return true;
+	}
+}
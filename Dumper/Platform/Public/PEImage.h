@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+
+/*
+* A PE file from disk, mapped into a local buffer the way the loader would map it. The headers and every section are placed at their RVAs,
+* and the remaining bytes are zero.
+*
+* Base-relocations are applied for the address of the local buffer, so absolute addresses inside of the image point into it, like they do for
+* a module the loader moved away from its preferred image-base. Imports aren't resolved.
+*
+* Doesn't depend on Windows headers, images can be loaded and scanned on any platform.
+*/
+class PEImage
+{
+private:
+	std::unique_ptr<uint8_t[]> Image;
+	uint32_t SizeOfImage = 0x0;
+
+	uint64_t PreferredImageBase = 0x0;
+
+	/* Without the directory, lowercase, to compare against module-names */
+	std::string ModuleName;
+
+public:
+	PEImage() = default;
+
+	PEImage(PEImage&&) = default;
+	PEImage& operator=(PEImage&&) = default;
+
+private:
+	/* Returns false if the relocation-directory is malformed, images without one (relocations stripped) are left as they are */
+	bool ApplyBaseRelocations(size_t OptionalHeader, uint16_t OptionalHeaderMagic);
+
+public:
+	bool LoadFromFile(const std::string& FilePath);
+	bool LoadFromBuffer(const uint8_t* Data, size_t Size);
+
+	void Reset();
+
+public:
+	inline bool IsLoaded() const { return Image != nullptr; }
+
+	/* Address of the local image, an RVA is an offset from it */
+	inline uintptr_t GetBase() const { return reinterpret_cast<uintptr_t>(Image.get()); }
+	inline uint32_t GetSize() const { return SizeOfImage; }
+
+	inline uint64_t GetPreferredImageBase() const { return PreferredImageBase; }
+
+	inline const std::string& GetModuleName() const { return ModuleName; }
+
+	inline bool IsInImage(uintptr_t Address) const { return Address >= GetBase() && (Address - GetBase()) < SizeOfImage; }
+};
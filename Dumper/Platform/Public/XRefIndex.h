@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+/*
+* Every RIP-relative reference in the code of an image, indexed by the address it refers to.
+*
+* Code-ranges are decoded in parallel slices, every byte is treated as a potential start of one of these instructions:
+*	E8 rel32                  call
+*	E9 rel32                  jmp
+*	FF 15 rel32               call [rip+rel32]
+*	FF 25 rel32               jmp  [rip+rel32]
+*	REX.W 8D/8B/89 modrm      lea/mov with a [rip+rel32] operand
+*
+* Only references to targets within the image are kept. Like the linear sweeps this replaces some candidates are bytes inside of other instructions,
+* callers verify the instruction at a site the same way they'd verify a match of a sweep.
+*
+* Building takes one pass over the code, after which "who references X" is a single hash-table lookup. Sites are stored as RVAs, grouped by
+* target and sorted in ascending order.
+*/
+class XRefIndex
+{
+private:
+	/* Open addressing, an empty bucket has 'NumSites' == 0 */
+	struct Bucket
+	{
+		uint32_t TargetRva = 0x0;
+		uint32_t FirstSite = 0x0;
+		uint32_t NumSites = 0x0;
+	};
+
+public:
+	struct CodeRange
+	{
+		uintptr_t Start;
+		size_t Size;
+	};
+
+private:
+	/* Size of the slices code-ranges are split into for the parallel decoding */
+	static constexpr size_t SliceSize = 0x40000;
+
+private:
+	uintptr_t ImageBase = 0x0;
+	uint32_t ImageSize = 0x0;
+
+	/* Number of buckets is a power of two */
+	std::vector<Bucket> Buckets;
+	std::vector<uint32_t> Sites;
+
+public:
+	XRefIndex() = default;
+
+private:
+	const Bucket* FindBucket(uint32_t TargetRva) const;
+
+public:
+	/* 'CodeRanges' must lie within [ImageBase, ImageBase + ImageSize) and be readable */
+	static XRefIndex Build(uintptr_t ImageBase, uint32_t ImageSize, const std::vector<CodeRange>& CodeRanges, uint32_t MaxThreads = 0x0);
+
+public:
+	inline bool IsEmpty() const { return Sites.empty(); }
+	inline size_t NumReferences() const { return Sites.size(); }
+
+	inline uintptr_t GetImageBase() const { return ImageBase; }
+
+	/* RVAs of all sites referencing 'Target', ascending */
+	std::span<const uint32_t> GetReferenceRvas(uintptr_t Target) const;
+
+	/* Lowest site referencing 'Target' in [StartAddress, EndAddress), 0 if there is none */
+	uintptr_t FindFirstReference(uintptr_t Target, uintptr_t StartAddress = 0x0, uintptr_t EndAddress = UINTPTR_MAX) const;
+};
@@ -132,4 +132,13 @@ void Settings::Config::Load()
 
 	SDKNamespaceName = SDKNamespace;
 	SleepTimeout = max(GetPrivateProfileIntA("Settings", "SleepTimeout", 0, ConfigPath), 0);
+
+	char ImagePath[MAX_PATH] = {};
+	GetPrivateProfileStringA("Settings", "StaticAnalysisImagePath", "", ImagePath, sizeof(ImagePath), ConfigPath);
+
+	char OffsetsPath[MAX_PATH] = {};
+	GetPrivateProfileStringA("Settings", "PrecomputedOffsetsPath", "", OffsetsPath, sizeof(OffsetsPath), ConfigPath);
+
+	StaticAnalysisImagePath = ImagePath;
+	PrecomputedOffsetsPath = OffsetsPath;
 }
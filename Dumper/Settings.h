@@ -22,6 +22,12 @@ namespace Settings
 		inline int SleepTimeout = 0;
 		inline std::string SDKNamespaceName = "SDK";
 
+		/* Path of the game's executable. If set, only the StaticOffsets are precomputed from the file on disk and nothing is dumped. */
+		inline std::string StaticAnalysisImagePath = "";
+
+		/* Where the StaticOffsets are written to when precomputing them, and read from when dumping. Empty to always search for them. */
+		inline std::string PrecomputedOffsetsPath = "";
+
 		void Load();
 	};
 
@@ -80,6 +86,15 @@ R"(
 
 		/* Adds the 'final' specifier to classes with no loaded child class at SDK-generation time. */
 		constexpr bool bAddFinalSpecifier = true;
+
+		/* Resolves all UFunctions of a class in a single pass on first use and adds 'TBatchInvoker' to dispatch many calls of one function back-to-back. */
+		constexpr bool bGenerateBatchedFunctionCalls = false;
+
+		/* Generates NameTable.hpp with the FNames of all classes, functions and properties as constexpr values. StaticClass()/StaticName() use them once they were validated at runtime. */
+		constexpr bool bGenerateNameTable = false;
+
+		/* Adds 'FGObjectsSnapshot' to Basic.hpp, a view of GObjects which can be iterated (and split across threads) while new objects are being added. */
+		constexpr bool bGenerateGObjectsSnapshot = false;
 	}
 
 	namespace MappingGenerator
@@ -2,6 +2,8 @@
 
 #include <fstream>
 
+static constexpr auto version = 10202;
+
 DSGen::DSGen()
 {
 }
@@ -11,6 +13,11 @@ void DSGen::setDirectory(const std::filesystem::path& directory)
 	DSGen::directory = directory;
 
 	dumpTimeStamp = std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+
+	classesFile = openStreamedFile("ClassesInfo.json");
+	structsFile = openStreamedFile("StructsInfo.json");
+	functionsFile = openStreamedFile("FunctionsInfo.json");
+	enumsFile = openStreamedFile("EnumsInfo.json");
 }
 
 void DSGen::addOffset(const std::string& name, uintptr_t offset)
@@ -107,111 +114,204 @@ void DSGen::createFunction(ClassHolder& owningClass, const std::string& function
 	owningClass.functions.push_back(f);
 }
 
+void DSGen::writeMemberType(JsonStreamWriter& writer, const MemberType& memberType)
+{
+	//same layout as MemberType::jsonify
+	writer.BeginArray();
+	writer.String(memberType.typeName);
+	writer.String(getTypeShort(memberType.type));
+	writer.String(memberType.extendedType);
+
+	writer.BeginArray();
+	for (auto& subType : memberType.subTypes)
+		writeMemberType(writer, subType);
+	writer.EndArray();
+
+	writer.EndArray();
+}
+
 void DSGen::bakeStructOrClass(ClassHolder& classHolder)
 {
-	nlohmann::json jClass;
+	std::unique_ptr<StreamedFile>& classOrStructFile = classHolder.classType == ET_Class ? classesFile : structsFile;
 
-	nlohmann::json membersArray = nlohmann::json::array();
+	if (!classOrStructFile)
+		throw std::exception("Please initialize a directory first!");
+
+	JsonStreamWriter& writer = classOrStructFile->writer;
 
-	nlohmann::json inheritInfo = nlohmann::json::array();
-	for (auto super : classHolder.interitedTypes)
-		inheritInfo.push_back(super);
+	writer.BeginObject();
+	writer.Key(classHolder.className);
+	writer.BeginArray();
 
-	nlohmann::json InheritInfo;
-	InheritInfo["__InheritInfo"] = inheritInfo;
-	membersArray.push_back(InheritInfo);
+	writer.BeginObject();
+	writer.Key("__InheritInfo");
+	writer.BeginArray();
+	for (auto& super : classHolder.interitedTypes)
+		writer.String(super);
+	writer.EndArray();
+	writer.EndObject();
 
-	nlohmann::json gSize;
-	gSize["__MDKClassSize"] = classHolder.classSize;
-	membersArray.push_back(gSize);
+	writer.BeginObject();
+	writer.Key("__MDKClassSize");
+	writer.Int(classHolder.classSize);
+	writer.EndObject();
 
-	for(auto& member : classHolder.members)
+	for (auto& member : classHolder.members)
 	{
-		nlohmann::json jmember;
+		writer.BeginObject();
+		writer.Key(member.memberName);
 
+		writer.BeginArray();
+		writeMemberType(writer, member.memberType);
+		writer.Int(member.offset);
+		writer.Int(member.size);
+		writer.Int(member.arrayDim);
 
 		if (member.bitOffset > -1)
-			jmember[member.memberName] = std::make_tuple(member.memberType.jsonify(), member.offset, member.size, member.arrayDim, member.bitOffset);
-		else
-			jmember[member.memberName] = std::make_tuple(member.memberType.jsonify(), member.offset, member.size, member.arrayDim);
-		membersArray.push_back(jmember);
+			writer.Int(member.bitOffset);
+
+		writer.EndArray();
+		writer.EndObject();
 	}
-	nlohmann::json j;
 
-	j[classHolder.className] = membersArray;
+	writer.EndArray();
+	writer.EndObject();
+
+	if (classHolder.functions.empty())
+		return;
 
-	if (classHolder.classType == ET_Class)
-		classes.push_back(j);
-	else
-		structs.push_back(j);
+	JsonStreamWriter& functionWriter = functionsFile->writer;
 
-	if(!classHolder.functions.empty())
+	functionWriter.BeginObject();
+	functionWriter.Key(classHolder.className);
+	functionWriter.BeginArray();
+
+	for (auto& func : classHolder.functions)
 	{
-		nlohmann::json classFunctions = nlohmann::json::array();
-		for (auto& func : classHolder.functions)
-		{
-			nlohmann::json functionParams = nlohmann::json::array();
+		functionWriter.BeginObject();
+		functionWriter.Key(func.functionName);
 
-			for (const auto& param : func.functionParams)
-				functionParams.push_back(std::make_tuple(param.first.jsonify(), param.first.reference ? "&" : "", param.second));
+		functionWriter.BeginArray();
+		writeMemberType(functionWriter, func.returnType);
 
-			nlohmann::json j1;
-			j1[func.functionName] = std::make_tuple(func.returnType.jsonify(), functionParams, func.functionOffset, func.functionFlags);
-			classFunctions.push_back(j1);
+		functionWriter.BeginArray();
+		for (const auto& param : func.functionParams)
+		{
+			functionWriter.BeginArray();
+			writeMemberType(functionWriter, param.first);
+			functionWriter.String(param.first.reference ? "&" : "");
+			functionWriter.String(param.second);
+			functionWriter.EndArray();
 		}
-		nlohmann::json f;
+		functionWriter.EndArray();
 
-		f[classHolder.className] = classFunctions;
+		functionWriter.UInt(func.functionOffset);
+		functionWriter.String(func.functionFlags);
+		functionWriter.EndArray();
 
-		functions.push_back(f);
+		functionWriter.EndObject();
 	}
 
+	functionWriter.EndArray();
+	functionWriter.EndObject();
 }
 
 void DSGen::bakeEnum(EnumHolder& enumHolder)
 {
-	nlohmann::json members = nlohmann::json::array();
-	for(const auto& member : enumHolder.enumMembers)
+	if (!enumsFile)
+		throw std::exception("Please initialize a directory first!");
+
+	JsonStreamWriter& writer = enumsFile->writer;
+
+	writer.BeginObject();
+	writer.Key(enumHolder.enumName);
+	writer.BeginArray();
+
+	writer.BeginArray();
+	for (const auto& member : enumHolder.enumMembers)
 	{
-		nlohmann::json m;
-		m[member.first] = member.second;
-		members.push_back(m);
+		writer.BeginObject();
+		writer.Key(member.first);
+		writer.Int(member.second);
+		writer.EndObject();
 	}
-	nlohmann::json j;
-	j[enumHolder.enumName] = std::make_tuple(members, enumHolder.enumType);
-	enums.push_back(j);
+	writer.EndArray();
+
+	writer.String(enumHolder.enumType);
+
+	writer.EndArray();
+	writer.EndObject();
+}
+
+std::unique_ptr<DSGen::StreamedFile> DSGen::openStreamedFile(const std::string& fileName)
+{
+	auto streamedFile = std::make_unique<StreamedFile>(directory / fileName);
+
+	streamedFile->writer.BeginObject();
+	streamedFile->writer.Key("data");
+	streamedFile->writer.BeginArray();
+
+	return streamedFile;
+}
+
+void DSGen::finishStreamedFile(std::unique_ptr<StreamedFile>& streamedFile)
+{
+	if (!streamedFile)
+		return;
+
+	JsonStreamWriter& writer = streamedFile->writer;
+
+	writer.EndArray();
+	writer.Key("updated_at");
+	writer.String(dumpTimeStamp);
+	writer.Key("version");
+	writer.Int(version);
+	writer.EndObject();
+
+	streamedFile.reset();
 }
 
+// Keys are written in the sorted order nlohmann::json used to store them in: "credit", "data", "updated_at", "version"
 void DSGen::dump()
 {
 	if (directory.empty())
 		throw std::exception("Please initialize a directory first!");
 
-	constexpr auto version = 10202;
-
-	auto saveToDisk = [&](const nlohmann::json& json, const std::string& fileName, bool offsetFile = false)
 	{
-		nlohmann::json j;
-		j["updated_at"] = dumpTimeStamp;
-		j["data"] = json;
-		j["version"] = version;
-
-		if(offsetFile){
-			nlohmann::json credit;
-			credit["dumper_used"] = "Dumper-7";
-			credit["dumper_link"] = "https://github.com/Encryqed/Dumper-7";
-			j["credit"] = credit;
+		std::ofstream file(directory / "OffsetsInfo.json");
+		JsonStreamWriter writer(file);
+
+		writer.BeginObject();
+
+		writer.Key("credit");
+		writer.BeginObject();
+		writer.Key("dumper_link");
+		writer.String("https://github.com/Encryqed/Dumper-7");
+		writer.Key("dumper_used");
+		writer.String("Dumper-7");
+		writer.EndObject();
+
+		writer.Key("data");
+		writer.BeginArray();
+		for (const auto& [name, offset] : offsets)
+		{
+			writer.BeginArray();
+			writer.String(name);
+			writer.UInt(offset);
+			writer.EndArray();
 		}
+		writer.EndArray();
 
-		std::ofstream file(directory / fileName);
-		file << j.dump(-1, ' ', false, nlohmann::detail::error_handler_t::replace);
-	};
-
-	saveToDisk(nlohmann::json(nlohmann::json(offsets)), "OffsetsInfo.json", true);
-	saveToDisk(nlohmann::json(classes), "ClassesInfo.json");
-	saveToDisk(nlohmann::json(functions), "FunctionsInfo.json");
-	saveToDisk(nlohmann::json(structs), "StructsInfo.json");
-	saveToDisk(nlohmann::json(enums), "EnumsInfo.json");
+		writer.Key("updated_at");
+		writer.String(dumpTimeStamp);
+		writer.Key("version");
+		writer.Int(version);
 
+		writer.EndObject();
+	}
 
+	finishStreamedFile(classesFile);
+	finishStreamedFile(functionsFile);
+	finishStreamedFile(structsFile);
+	finishStreamedFile(enumsFile);
 }
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <string>
+#include <memory>
+#include <fstream>
 #include <filesystem>
 #include "../Json/json.hpp"
+#include "../Json/JsonStreamWriter.h"
 
 class DSGen
 {
@@ -120,6 +123,19 @@ public:
 
 
 
+private:
+	// A dumpspace file that is written while baking. Entries are streamed into its "data" array, the rest is written by dump()
+	struct StreamedFile
+	{
+		std::ofstream file;
+		JsonStreamWriter writer;
+
+		StreamedFile(const std::filesystem::path& path)
+			: file(path), writer(file)
+		{
+		}
+	};
+
 private:
 	static inline std::string dumpTimeStamp{};
 
@@ -127,17 +143,23 @@ private:
 
 	static inline std::vector<std::tuple<std::string, uintptr_t>> offsets{};
 
-	static inline nlohmann::json classes = nlohmann::json::array();
-	static inline nlohmann::json structs = nlohmann::json::array();
-	static inline nlohmann::json functions = nlohmann::json::array();
-	static inline nlohmann::json enums = nlohmann::json::array();
+	static inline std::unique_ptr<StreamedFile> classesFile;
+	static inline std::unique_ptr<StreamedFile> structsFile;
+	static inline std::unique_ptr<StreamedFile> functionsFile;
+	static inline std::unique_ptr<StreamedFile> enumsFile;
+
+private:
+	static std::unique_ptr<StreamedFile> openStreamedFile(const std::string& fileName);
+	static void finishStreamedFile(std::unique_ptr<StreamedFile>& streamedFile);
+
+	static void writeMemberType(JsonStreamWriter& writer, const MemberType& memberType);
 
 public:
 	//redundant constructor
 	DSGen();
 
 	/**
-	 * \brief sets the directory path. The dumpspace files will be under directory/dumpspace
+	 * \brief sets the directory path and opens the dumpspace files under directory/dumpspace. Must be called before baking
 	 * \param directory valid directory
 	 */
 	static void setDirectory(const std::filesystem::path& directory);
@@ -259,20 +281,20 @@ public:
 	);
 
 	/**
-	 * \brief bakes a ClassHolder which gets later dumped
+	 * \brief bakes a ClassHolder, it is written to its file right away
 	 * \param classHolder the classHolder that should get baked
 	 */
 	static void bakeStructOrClass(ClassHolder& classHolder);
 
 	/**
-	 * \brief bakes a EnumHolder which gets later dumped
+	 * \brief bakes a EnumHolder, it is written to its file right away
 	 * \param enumHolder the enumHolder that should get baked
 	 */
 	static void bakeEnum(EnumHolder& enumHolder);
 
 
 	/**
-	 * \brief dumps all baked information to disk. This should be the final step
+	 * \brief dumps the offsets and finishes all files. This should be the final step
 	 */
 	static void dump();
 };
\ No newline at end of file
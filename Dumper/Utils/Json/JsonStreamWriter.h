@@ -0,0 +1,161 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "json.hpp"
+
+
+/*
+* Writes JSON directly to a stream while it's being generated, instead of building a nlohmann::json tree first.
+*
+* The output is byte-identical to nlohmann::json::dump(-1, ' ', false, error_handler_t::replace), given that object-keys are written in the
+* sorted order nlohmann::json would store them in. Ensuring this order is up to the caller.
+*/
+class JsonStreamWriter
+{
+private:
+	static constexpr size_t FlushThreshold = 0x10000;
+
+private:
+	std::ostream& Stream;
+	std::string Buffer;
+
+	/* One entry per open object or array, true once it contains a value and the next one needs a separating ',' */
+	std::vector<bool> OpenScopes;
+
+	bool bIsAfterKey = false;
+
+public:
+	inline explicit JsonStreamWriter(std::ostream& OutStream)
+		: Stream(OutStream)
+	{
+		Buffer.reserve(FlushThreshold * 2);
+	}
+
+	inline ~JsonStreamWriter()
+	{
+		Flush();
+	}
+
+	JsonStreamWriter(const JsonStreamWriter&) = delete;
+	JsonStreamWriter& operator=(const JsonStreamWriter&) = delete;
+
+private:
+	inline void BeforeValue()
+	{
+		if (bIsAfterKey)
+		{
+			bIsAfterKey = false;
+			return;
+		}
+
+		if (OpenScopes.empty())
+			return;
+
+		if (OpenScopes.back())
+			Buffer += ',';
+
+		OpenScopes.back() = true;
+	}
+
+	inline void AfterValue()
+	{
+		if (Buffer.size() >= FlushThreshold)
+			Flush();
+	}
+
+	inline void WriteEscaped(std::string_view Value)
+	{
+		bool bNeedsEscaping = false;
+
+		for (const char C : Value)
+		{
+			const unsigned char UnsignedC = static_cast<unsigned char>(C);
+
+			if (UnsignedC < 0x20 || UnsignedC >= 0x80 || C == '"' || C == '\\')
+			{
+				bNeedsEscaping = true;
+				break;
+			}
+		}
+
+		if (!bNeedsEscaping) [[likely]]
+		{
+			Buffer += '"';
+			Buffer += Value;
+			Buffer += '"';
+			return;
+		}
+
+		/* Rare, let nlohmann handle escape-sequences and the replacement of invalid UTF-8 so the output stays identical */
+		Buffer += nlohmann::json(std::string(Value)).dump(-1, ' ', false, nlohmann::detail::error_handler_t::replace);
+	}
+
+public:
+	inline void BeginObject()
+	{
+		BeforeValue();
+		Buffer += '{';
+		OpenScopes.push_back(false);
+	}
+
+	inline void EndObject()
+	{
+		Buffer += '}';
+		OpenScopes.pop_back();
+		AfterValue();
+	}
+
+	inline void BeginArray()
+	{
+		BeforeValue();
+		Buffer += '[';
+		OpenScopes.push_back(false);
+	}
+
+	inline void EndArray()
+	{
+		Buffer += ']';
+		OpenScopes.pop_back();
+		AfterValue();
+	}
+
+	inline void Key(std::string_view Name)
+	{
+		BeforeValue();
+		WriteEscaped(Name);
+		Buffer += ':';
+
+		bIsAfterKey = true;
+	}
+
+	inline void String(std::string_view Value)
+	{
+		BeforeValue();
+		WriteEscaped(Value);
+		AfterValue();
+	}
+
+	inline void Int(int64_t Value)
+	{
+		BeforeValue();
+		Buffer += std::to_string(Value);
+		AfterValue();
+	}
+
+	inline void UInt(uint64_t Value)
+	{
+		BeforeValue();
+		Buffer += std::to_string(Value);
+		AfterValue();
+	}
+
+	inline void Flush()
+	{
+		Stream.write(Buffer.data(), Buffer.size());
+		Buffer.clear();
+	}
+};
@@ -0,0 +1,90 @@
+#include "Profiler.h"
+
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+#include "../Json/json.hpp"
+#include "Settings.h"
+
+
+namespace
+{
+	struct PhaseInfo
+	{
+		const char* Category;
+		std::string Name;
+
+		Profiler::ClockType::time_point StartTime;
+		Profiler::ClockType::time_point EndTime;
+	};
+
+	std::mutex PhaseMutex;
+	std::vector<PhaseInfo> Phases;
+}
+
+const char* Profiler::StringifyCounter(ECounter Counter)
+{
+	switch (Counter)
+	{
+	case ECounter::NamesResolved:
+		return "NamesResolved";
+	case ECounter::IsBadReadPtrCalls:
+		return "IsBadReadPtrCalls";
+	case ECounter::PatternScans:
+		return "PatternScans";
+	case ECounter::BytesWritten:
+		return "BytesWritten";
+	default:
+		return "Invalid";
+	}
+}
+
+void Profiler::AddPhase(const char* Category, const std::string& Name, ClockType::time_point StartTime, ClockType::time_point EndTime)
+{
+	std::scoped_lock Lock(PhaseMutex);
+
+	Phases.push_back({ Category, Name, StartTime, EndTime });
+}
+
+void Profiler::WriteToFile(const std::filesystem::path& FilePath)
+{
+	std::scoped_lock Lock(PhaseMutex);
+
+	nlohmann::json ProfileJson;
+	ProfileJson["GameName"] = Settings::Generator::GameName;
+	ProfileJson["GameVersion"] = Settings::Generator::GameVersion;
+
+	/* Start-times are relative to the first phase that was started */
+	ClockType::time_point FirstStartTime = !Phases.empty() ? Phases.front().StartTime : ClockType::now();
+
+	for (const PhaseInfo& Phase : Phases)
+	{
+		if (Phase.StartTime < FirstStartTime)
+			FirstStartTime = Phase.StartTime;
+	}
+
+	nlohmann::json& PhasesJson = ProfileJson["Phases"];
+	PhasesJson = nlohmann::json::array();
+
+	for (const PhaseInfo& Phase : Phases)
+	{
+		const std::chrono::duration<double, std::milli> StartOffset = Phase.StartTime - FirstStartTime;
+		const std::chrono::duration<double, std::milli> Duration = Phase.EndTime - Phase.StartTime;
+
+		PhasesJson.push_back({
+			{ "Category", Phase.Category },
+			{ "Name", Phase.Name },
+			{ "StartMs", StartOffset.count() },
+			{ "DurationMs", Duration.count() },
+		});
+	}
+
+	nlohmann::json& CountersJson = ProfileJson["Counters"];
+
+	for (uint8_t i = 0; i < static_cast<uint8_t>(ECounter::Num); i++)
+		CountersJson[StringifyCounter(static_cast<ECounter>(i))] = Counters[i].load(std::memory_order_relaxed);
+
+	std::ofstream ProfileFile(FilePath);
+	ProfileFile << ProfileJson.dump(4);
+}
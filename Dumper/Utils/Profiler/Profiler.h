@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <filesystem>
+
+
+/*
+* Always-on timings and counters for a single dump. Written to 'DumpProfile.json' once the SDK was generated, to compare dumps across game-updates.
+*
+* Counters are relaxed atomics and phases are added under a lock, both may be used from any thread.
+*/
+namespace Profiler
+{
+	using ClockType = std::chrono::high_resolution_clock;
+
+	enum class ECounter : uint8_t
+	{
+		NamesResolved,
+		IsBadReadPtrCalls,
+		PatternScans,
+		BytesWritten,
+
+		Num
+	};
+
+	inline std::atomic<uint64_t> Counters[static_cast<uint8_t>(ECounter::Num)];
+
+	inline void Increment(ECounter Counter, uint64_t Amount = 0x1)
+	{
+		Counters[static_cast<uint8_t>(Counter)].fetch_add(Amount, std::memory_order_relaxed);
+	}
+
+	const char* StringifyCounter(ECounter Counter);
+
+	/* 'Category' groups phases in the output, eg. "InitEngineCore" or "Generate" */
+	void AddPhase(const char* Category, const std::string& Name, ClockType::time_point StartTime, ClockType::time_point EndTime);
+
+	void WriteToFile(const std::filesystem::path& FilePath);
+
+	class ScopedTimer
+	{
+	private:
+		const char* Category;
+		std::string Name;
+
+		ClockType::time_point StartTime;
+
+	public:
+		inline ScopedTimer(const char* InCategory, std::string InName)
+			: Category(InCategory), Name(std::move(InName)), StartTime(ClockType::now())
+		{
+		}
+
+		inline ~ScopedTimer()
+		{
+			AddPhase(Category, Name, StartTime, ClockType::now());
+		}
+
+		ScopedTimer(const ScopedTimer&) = delete;
+		ScopedTimer& operator=(const ScopedTimer&) = delete;
+	};
+}
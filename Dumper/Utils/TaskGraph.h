@@ -0,0 +1,211 @@
+#pragma once
+
+#include <iostream>
+#include <format>
+#include <vector>
+#include <string>
+#include <functional>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cassert>
+
+
+/*
+* A small set of tasks with declared dependencies, executed on a pool of worker threads.
+*
+* A task is started once all of the tasks it depends on have finished. Tasks that don't (indirectly) depend on each other may run at the same
+* time, so they must not write to the same data. Dependencies can only be added on tasks that already exist, which makes cycles impossible.
+*/
+class TaskGraph
+{
+public:
+	using TaskHandle = int32_t;
+
+private:
+	struct Task
+	{
+		std::string Name;
+		std::function<void()> Function;
+
+		/* Tasks waiting on this one */
+		std::vector<TaskHandle> Dependents;
+		int32_t NumUnfinishedDependencies = 0x0;
+
+		std::chrono::high_resolution_clock::time_point StartTime;
+		std::chrono::high_resolution_clock::time_point EndTime;
+	};
+
+public:
+	struct TaskTiming
+	{
+		const std::string& Name;
+
+		std::chrono::high_resolution_clock::time_point StartTime;
+		std::chrono::high_resolution_clock::time_point EndTime;
+	};
+
+private:
+	std::vector<Task> Tasks;
+
+	std::chrono::high_resolution_clock::time_point RunStartTime;
+
+public:
+	inline TaskHandle AddTask(std::string Name, std::function<void()> Function, std::initializer_list<TaskHandle> Dependencies = {})
+	{
+		const TaskHandle NewHandle = static_cast<TaskHandle>(Tasks.size());
+
+		for (const TaskHandle Dependency : Dependencies)
+		{
+			assert(Dependency >= 0 && Dependency < NewHandle && "Dependency of a task in 'TaskGraph' must be added before the task itself!");
+
+			Tasks[Dependency].Dependents.push_back(NewHandle);
+		}
+
+		Tasks.push_back(Task{ std::move(Name), std::move(Function), {}, static_cast<int32_t>(Dependencies.size()) });
+
+		return NewHandle;
+	}
+
+	/* Blocks until all tasks have finished. 'MaxThreads' == 0 uses one thread per hardware-thread, capped at the number of tasks. */
+	inline void Run(uint32_t MaxThreads = 0x0)
+	{
+		if (Tasks.empty())
+			return;
+
+		if (MaxThreads == 0x0)
+			MaxThreads = std::thread::hardware_concurrency();
+
+		uint32_t NumThreads = MaxThreads < Tasks.size() ? MaxThreads : static_cast<uint32_t>(Tasks.size());
+
+		/* hardware_concurrency() may return 0 */
+		if (NumThreads == 0x0)
+			NumThreads = 0x1;
+
+		std::mutex QueueMutex;
+		std::condition_variable QueueCondition;
+
+		std::vector<TaskHandle> ReadyTasks;
+		size_t NumFinishedTasks = 0x0;
+
+		for (int i = 0; i < Tasks.size(); i++)
+		{
+			if (Tasks[i].NumUnfinishedDependencies == 0x0)
+				ReadyTasks.push_back(i);
+		}
+
+		RunStartTime = std::chrono::high_resolution_clock::now();
+
+		auto WorkerLoop = [&]() -> void
+		{
+			std::unique_lock Lock(QueueMutex);
+
+			while (true)
+			{
+				QueueCondition.wait(Lock, [&]() { return !ReadyTasks.empty() || NumFinishedTasks == Tasks.size(); });
+
+				if (ReadyTasks.empty())
+					return;
+
+				Task& Current = Tasks[ReadyTasks.back()];
+				ReadyTasks.pop_back();
+
+				Lock.unlock();
+
+				Current.StartTime = std::chrono::high_resolution_clock::now();
+				Current.Function();
+				Current.EndTime = std::chrono::high_resolution_clock::now();
+
+				Lock.lock();
+
+				NumFinishedTasks++;
+
+				for (const TaskHandle Dependent : Current.Dependents)
+				{
+					if (--Tasks[Dependent].NumUnfinishedDependencies == 0x0)
+						ReadyTasks.push_back(Dependent);
+				}
+
+				QueueCondition.notify_all();
+			}
+		};
+
+		std::vector<std::thread> Workers;
+		Workers.reserve(NumThreads - 1);
+
+		for (uint32_t i = 1; i < NumThreads; i++)
+			Workers.emplace_back(WorkerLoop);
+
+		/* The calling thread takes part as well */
+		WorkerLoop();
+
+		for (std::thread& Worker : Workers)
+			Worker.join();
+	}
+
+	inline void PrintTimings(const char* GraphName) const
+	{
+		for (const Task& CurrentTask : Tasks)
+		{
+			const std::chrono::duration<double, std::milli> Duration = CurrentTask.EndTime - CurrentTask.StartTime;
+			const std::chrono::duration<double, std::milli> StartOffset = CurrentTask.StartTime - RunStartTime;
+
+			std::cerr << std::format("[{}] {} took ({:.2f}ms), started at {:.2f}ms\n", GraphName, CurrentTask.Name, Duration.count(), StartOffset.count());
+		}
+
+		std::cerr << '\n';
+	}
+
+	/* In the order the tasks were added, only valid after Run() */
+	inline std::vector<TaskTiming> GetTimings() const
+	{
+		std::vector<TaskTiming> Timings;
+		Timings.reserve(Tasks.size());
+
+		for (const Task& CurrentTask : Tasks)
+			Timings.push_back({ CurrentTask.Name, CurrentTask.StartTime, CurrentTask.EndTime });
+
+		return Timings;
+	}
+};
+
+
+/*
+* Calls 'Function' once for every index in [0, Num) on a pool of threads, the calling thread takes part as well. Indices are handed out one at
+* a time, so uneven work per index (eg. packages of very different sizes) is balanced. The order in which indices run is not deterministic.
+*/
+inline void ParallelFor(size_t Num, const std::function<void(size_t)>& Function, uint32_t MaxThreads = 0x0)
+{
+	if (Num == 0x0)
+		return;
+
+	if (MaxThreads == 0x0)
+		MaxThreads = std::thread::hardware_concurrency();
+
+	uint32_t NumThreads = MaxThreads < Num ? MaxThreads : static_cast<uint32_t>(Num);
+
+	/* hardware_concurrency() may return 0 */
+	if (NumThreads == 0x0)
+		NumThreads = 0x1;
+
+	std::atomic<size_t> NextIndex = 0x0;
+
+	auto WorkerLoop = [&]() -> void
+	{
+		for (size_t Index = NextIndex++; Index < Num; Index = NextIndex++)
+			Function(Index);
+	};
+
+	std::vector<std::thread> Workers;
+	Workers.reserve(NumThreads - 1);
+
+	for (uint32_t i = 1; i < NumThreads; i++)
+		Workers.emplace_back(WorkerLoop);
+
+	WorkerLoop();
+
+	for (std::thread& Worker : Workers)
+		Worker.join();
+}
@@ -2,6 +2,7 @@
 #include <iostream>
 #include <chrono>
 #include <fstream>
+#include <filesystem>
 
 #include "Generators/CppGenerator.h"
 #include "Generators/MappingGenerator.h"
@@ -9,6 +10,8 @@
 #include "Generators/DumpspaceGenerator.h"
 
 #include "Generators/Generator.h"
+#include "OffsetFinder/StaticOffsets.h"
+#include "Profiler/Profiler.h"
 
 enum class EFortToastType : uint8
 {
@@ -18,23 +21,8 @@ enum class EFortToastType : uint8
         EFortToastType_MAX             = 3,
 };
 
-DWORD MainThread(HMODULE Module)
+void GenerateSDK()
 {
-	AllocConsole();
-	FILE* Dummy;
-	freopen_s(&Dummy, "CONOUT$", "w", stderr);
-	freopen_s(&Dummy, "CONIN$", "r", stdin);
-
-	std::cerr << "Started Generation [Dumper-7]!\n";
-
-	Settings::Config::Load();
-
-	if (Settings::Config::SleepTimeout > 0)
-	{
-		std::cerr << "Sleeping for " << Settings::Config::SleepTimeout << "ms...\n";
-		Sleep(Settings::Config::SleepTimeout);
-	}
-
 	auto DumpStartTime = std::chrono::high_resolution_clock::now();
 
 	Generator::InitEngineCore();
@@ -61,10 +49,7 @@ DWORD MainThread(HMODULE Module)
 
 	std::cerr << "FolderName: " << (Settings::Generator::GameVersion + '-' + Settings::Generator::GameName) << "\n\n";
 
-	Generator::Generate<CppGenerator>();
-	Generator::Generate<MappingGenerator>();
-	Generator::Generate<IDAMappingGenerator>();
-	Generator::Generate<DumpspaceGenerator>();
+	Generator::GenerateConcurrently<CppGenerator, MappingGenerator, IDAMappingGenerator, DumpspaceGenerator>();
 
 	auto DumpFinishTime = std::chrono::high_resolution_clock::now();
 
@@ -72,6 +57,44 @@ DWORD MainThread(HMODULE Module)
 
 	std::cerr << "\n\nGenerating SDK took (" << DumpTime.count() << "ms)\n\n\n";
 
+	Profiler::AddPhase("Dump", "Total", DumpStartTime, DumpFinishTime);
+
+	if (!Generator::GetDumperFolder().empty())
+		Profiler::WriteToFile(Generator::GetDumperFolder() / "DumpProfile.json");
+}
+
+DWORD MainThread(HMODULE Module)
+{
+	AllocConsole();
+	FILE* Dummy;
+	freopen_s(&Dummy, "CONOUT$", "w", stderr);
+	freopen_s(&Dummy, "CONIN$", "r", stdin);
+
+	std::cerr << "Started Generation [Dumper-7]!\n";
+
+	Settings::Config::Load();
+
+	if (Settings::Config::SleepTimeout > 0)
+	{
+		std::cerr << "Sleeping for " << Settings::Config::SleepTimeout << "ms...\n";
+		Sleep(Settings::Config::SleepTimeout);
+	}
+
+	/* Static analysis only reads the game's executable from disk, there is nothing to dump */
+	if (!Settings::Config::StaticAnalysisImagePath.empty())
+	{
+		const std::string OutputPath = !Settings::Config::PrecomputedOffsetsPath.empty()
+			? Settings::Config::PrecomputedOffsetsPath
+			: (std::filesystem::path(Settings::Generator::SDKGenerationPath) / "PrecomputedOffsets.json").string();
+
+		if (StaticOffsets::Precompute(Settings::Config::StaticAnalysisImagePath, OutputPath))
+			std::cerr << "Precomputed offsets were written to \"" << OutputPath << "\"\n\n";
+	}
+	else
+	{
+		GenerateSDK();
+	}
+
 	while (true)
 	{
 		if (GetAsyncKeyState(VK_F6) & 1)